@@ -44,7 +44,8 @@ enum class EngineMode {
     LOG,        // Full logging and UCI functionality
     NOINIT,     // Ignore all input except quit, no logging
     LOOP,       // Infinite loop on isready
-    LOSSONTIME  // Progressively waste time until time loss
+    LOSSONTIME, // Progressively waste time until time loss
+    INSTANT     // Answer go with bestmove only, no logging, for throughput benchmarks
 };
 
 // =============================================================================
@@ -76,7 +77,7 @@ std::string getTimestamp() {
 
 void log(const std::string& type, const std::string& message) {
     if (engineMode != EngineMode::LOG) {
-        return; // No logging in NOINIT or LOSSONTIME mode
+        return; // No logging in NOINIT, LOSSONTIME or INSTANT mode
     }
     
     std::string timestamp = getTimestamp();
@@ -168,6 +169,8 @@ EngineMode detectEngineMode(const std::string& executablePath) {
         return EngineMode::LOOP;
     } else if (filename.find("lossontime") != std::string::npos) {
         return EngineMode::LOSSONTIME;
+    } else if (filename.find("instant") != std::string::npos) {
+        return EngineMode::INSTANT;
     } else {
         return EngineMode::LOG;
     }
@@ -365,9 +368,11 @@ void handleGoCommand(const std::string& line) {
     log("SEARCH", "Randomly selected move " + std::to_string(randomIndex + 1) + 
                   " of " + std::to_string(legalMoves.size()) + ": " + bestmove);
     
-    // Send info and bestmove immediately
-    sendOutput("info depth 1 score cp 0 nodes " + std::to_string(legalMoves.size()) + 
-               " nps 1000 time 1");
+    // Send info and bestmove immediately, INSTANT mode keeps the GUI side parsing minimal
+    if (engineMode != EngineMode::INSTANT) {
+        sendOutput("info depth 1 score cp 0 nodes " + std::to_string(legalMoves.size()) + 
+                   " nps 1000 time 1");
+    }
     sendOutput("bestmove " + bestmove);
 }
 
@@ -483,6 +488,23 @@ void runNoInitMode() {
     }
 }
 
+// =============================================================================
+// Main Loop - INSTANT Mode
+// =============================================================================
+
+void runInstantMode() {
+    // No per command logging or stdin state checks, the only cost is the protocol itself
+    std::string line;
+    int commandCount = 0;
+    
+    while (std::getline(std::cin, line)) {
+        commandCount++;
+        if (!processCommand(line, commandCount)) {
+            break;
+        }
+    }
+}
+
 // =============================================================================
 // Main Entry Point
 // =============================================================================
@@ -531,6 +553,10 @@ int main([[maybe_unused]] int argc, char* argv[]) {
         case EngineMode::LOSSONTIME:
             runLogMode(); // Same as LOG mode, but go command wastes time
             break;
+            
+        case EngineMode::INSTANT:
+            runInstantMode();
+            break;
     }
     
     if (logFile.is_open()) {
@@ -0,0 +1,214 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "adaptive-concurrency.h"
+#include "os-helpers.h"
+
+#include <chess-game/game-record.h>
+#include <chess-game/game-result.h>
+#include <base-elements/time-control.h>
+
+#include <algorithm>
+#include <format>
+
+using QaplaTester::GameEndCause;
+using QaplaTester::GameRecord;
+using QaplaTester::GameResult;
+
+namespace QaplaWindows {
+
+namespace {
+    constexpr auto SAMPLE_INTERVAL = std::chrono::milliseconds(250);
+    constexpr auto EVALUATION_INTERVAL = std::chrono::seconds(5);
+    constexpr size_t WINDOW_INTERVALS = 12;        ///< Evaluation intervals rated together
+
+    constexpr double CPU_HEADROOM = 0.90;          ///< Raise concurrency below this CPU load
+    constexpr double MAX_FORFEIT_RATE = 0.02;      ///< Lower concurrency above this time forfeit rate
+    constexpr uint32_t MIN_FORFEIT_GAMES = 10;     ///< Games needed to rate forfeits
+    constexpr uint32_t MAX_FORFEITS = 3;           ///< Lower concurrency at this many forfeits in any case
+    constexpr double MAX_OVERSHOOT_RATE = 0.05;    ///< Lower concurrency above this overshoot rate
+    constexpr double CLEAN_OVERSHOOT_RATE = 0.01;  ///< Raise concurrency only below this overshoot rate
+    constexpr uint32_t MIN_OVERSHOOT_MOVES = 50;   ///< Moves needed to rate overshoots
+    constexpr uint64_t OVERSHOOT_TOLERANCE_MS = 10;
+}
+
+void AdaptiveConcurrency::reset(uint32_t start) {
+    target_ = start;
+    interval_ = {};
+    window_.clear();
+    slots_.clear();
+    lastCpuTimes_ = QaplaHelpers::OsHelpers::getCpuTimes();
+    lastSample_ = {};
+    lastEvaluation_ = std::chrono::steady_clock::now();
+}
+
+uint32_t AdaptiveConcurrency::decide(uint32_t current, uint32_t maximum, const Measurement& measurement) {
+    maximum = std::max(1U, maximum);
+    current = std::clamp(current, 1U, maximum);
+
+    const bool tooManyForfeits = measurement.forfeits >= MAX_FORFEITS
+        || (measurement.games >= MIN_FORFEIT_GAMES 
+            && measurement.forfeits > MAX_FORFEIT_RATE * measurement.games);
+    const double overshootRate = measurement.moves == 0 ? 0.0 
+        : static_cast<double>(measurement.overshoots) / measurement.moves;
+    const bool overshooting = measurement.moves >= MIN_OVERSHOOT_MOVES && overshootRate > MAX_OVERSHOOT_RATE;
+
+    if (tooManyForfeits || overshooting) {
+        return std::max(1U, current - std::max(1U, current / 4));
+    }
+    const bool clean = measurement.forfeits == 0 && overshootRate < CLEAN_OVERSHOOT_RATE;
+    if (clean && measurement.cpuLoad && *measurement.cpuLoad < CPU_HEADROOM) {
+        return std::min(maximum, current + std::max(1U, current / 8));
+    }
+    return current;
+}
+
+bool AdaptiveConcurrency::isClockOvershoot(uint64_t timeMs, int64_t clockMs, uint64_t incrementMs) {
+    // Engines plan far less for a single move, thus this happens when an engine does not 
+    // get the CPU time it planned with
+    return static_cast<int64_t>(timeMs) > clockMs + static_cast<int64_t>(incrementMs + OVERSHOOT_TOLERANCE_MS);
+}
+
+std::optional<double> AdaptiveConcurrency::sampleCpuLoad() {
+    auto times = QaplaHelpers::OsHelpers::getCpuTimes();
+    if (!times || !lastCpuTimes_) {
+        lastCpuTimes_ = times;
+        return std::nullopt;
+    }
+    const auto [busy, total] = *times;
+    const auto [lastBusy, lastTotal] = *lastCpuTimes_;
+    lastCpuTimes_ = times;
+    if (total <= lastTotal || busy < lastBusy) {
+        return std::nullopt;
+    }
+    return static_cast<double>(busy - lastBusy) / static_cast<double>(total - lastTotal);
+}
+
+void AdaptiveConcurrency::sampleGames(const GameManagerPoolAccess& poolAccess) {
+    poolAccess->withGameRecords(
+        [&](const GameRecord& game, uint32_t gameIndex) {
+            auto& slot = slots_[gameIndex];
+            const auto& history = game.history();
+            auto gameId = std::format("{}|{}|{}|{}|{}", game.getWhiteEngineName(), game.getBlackEngineName(),
+                game.getRound(), game.getGameInRound(), game.getOpeningNo());
+            // Moves played before the game was seen are summed up for the clock but not rated
+            size_t rateFrom = slot.moves;
+            if (gameId != slot.gameId || history.size() < slot.moves) {
+                slot = SlotState{ .gameId = gameId };
+                rateFrom = history.size();
+            }
+
+            const auto& whiteTime = game.getWhiteTimeControl();
+            const auto& blackTime = game.getBlackTimeControl();
+            const bool timed = whiteTime.isValid() && blackTime.isValid();
+            uint64_t moveTimeMs = 0;
+            if (timed) {
+                moveTimeMs = std::max(whiteTime.moveTimeMs().value_or(0), blackTime.moveTimeMs().value_or(0));
+            }
+            const bool clocked = timed && moveTimeMs == 0 
+                && !whiteTime.timeSegments().empty() && !blackTime.timeSegments().empty();
+            const auto nextMoveIndex = game.nextMoveIndex();
+            for (size_t index = slot.moves; index < history.size(); ++index) {
+                const uint64_t timeMs = history[index].timeMs;
+                // The side to move alternates from the position of the next move backwards
+                const bool whiteMoved = game.isWhiteToMove() != ((nextMoveIndex + index) % 2 == 1);
+                (whiteMoved ? slot.whiteUsedMs : slot.blackUsedMs) += timeMs;
+                if (index < rateFrom) {
+                    continue;
+                }
+                if (moveTimeMs > 0) {
+                    interval_.moves++;
+                    if (timeMs > moveTimeMs + std::max(OVERSHOOT_TOLERANCE_MS, moveTimeMs / 20)) {
+                        interval_.overshoots++;
+                    }
+                } else if (clocked) {
+                    auto goLimits = createGoLimits(whiteTime, blackTime, game.halfmoveNoAtPly(index + 1),
+                        slot.whiteUsedMs, slot.blackUsedMs, !whiteMoved);
+                    const auto& moverTime = whiteMoved ? whiteTime : blackTime;
+                    const auto clockMs = static_cast<int64_t>(whiteMoved ? goLimits.wtimeMs : goLimits.btimeMs);
+                    interval_.moves++;
+                    if (isClockOvershoot(timeMs, clockMs, moverTime.timeSegments().front().incrementMs)) {
+                        interval_.overshoots++;
+                    }
+                }
+            }
+            slot.moves = history.size();
+
+            auto [cause, result] = game.getGameResult();
+            if (!slot.finished && result != GameResult::Unterminated) {
+                slot.finished = true;
+                interval_.games++;
+                if (cause == GameEndCause::Timeout) {
+                    interval_.forfeits++;
+                }
+            }
+        },
+        []([[maybe_unused]] uint32_t gameIndex) -> bool {
+            return true;
+        });
+}
+
+uint32_t AdaptiveConcurrency::poll(const GameManagerPoolAccess& poolAccess, uint32_t maximum) {
+    maximum = std::max(1U, maximum);
+    if (target_ == 0) {
+        target_ = std::max(1U, maximum / 2);
+    }
+    target_ = std::min(target_, maximum);
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastSample_ < SAMPLE_INTERVAL) {
+        return target_;
+    }
+    lastSample_ = now;
+    sampleGames(poolAccess);
+
+    if (now - lastEvaluation_ < EVALUATION_INTERVAL) {
+        return target_;
+    }
+    lastEvaluation_ = now;
+    interval_.cpuLoad = sampleCpuLoad();
+    window_.push_back(interval_);
+    interval_ = {};
+    if (window_.size() > WINDOW_INTERVALS) {
+        window_.pop_front();
+    }
+    auto next = decide(target_, maximum, windowMeasurement());
+    if (next != target_) {
+        // Measurements of the old concurrency do not count for the new one
+        target_ = next;
+        window_.clear();
+    }
+    return target_;
+}
+
+AdaptiveConcurrency::Measurement AdaptiveConcurrency::windowMeasurement() const {
+    Measurement sum;
+    for (const auto& interval : window_) {
+        sum.moves += interval.moves;
+        sum.overshoots += interval.overshoots;
+        sum.games += interval.games;
+        sum.forfeits += interval.forfeits;
+    }
+    // The CPU load is a current value, only the newest interval counts
+    if (!window_.empty()) {
+        sum.cpuLoad = window_.back().cpuLoad;
+    }
+    return sum;
+}
+
+} // namespace QaplaWindows
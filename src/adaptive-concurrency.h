@@ -0,0 +1,119 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "game-manager-pool-access.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Controller for the "auto" concurrency mode.
+ * 
+ * Measures CPU saturation of the machine and watches the running games of the pool for 
+ * time forfeits and overshooting moves. A move overshoots if it exceeds a fixed move time 
+ * or, with a clock, if it spends more than the clock left after it plus one increment. 
+ * Every evaluation interval it raises the number of concurrent games while the CPU has 
+ * headroom and the games are clean, and lowers it when games lose on time or overshoot. Games and moves are 
+ * rated over a sliding window of the last evaluation intervals, so old forfeits expire.
+ */
+class AdaptiveConcurrency {
+public:
+    /**
+     * @brief Measurements of the games played at the current concurrency.
+     */
+    struct Measurement {
+        std::optional<double> cpuLoad;  ///< CPU saturation (0-1) of the last interval, if available
+        uint32_t moves = 0;             ///< Moves played with a fixed move time or a clock
+        uint32_t overshoots = 0;        ///< Moves exceeding their move time or overspending the clock
+        uint32_t games = 0;             ///< Finished games
+        uint32_t forfeits = 0;          ///< Games lost on time
+    };
+
+    /**
+     * @brief Restarts the controller.
+     * @param start Concurrency to start with, 0 starts with half of the maximum.
+     */
+    void reset(uint32_t start);
+
+    /**
+     * @brief Samples the pool and returns the concurrency the pool should use.
+     * @param poolAccess Access to the pool running the games.
+     * @param maximum Upper limit for the concurrency.
+     * @return The target concurrency, between 1 and maximum.
+     */
+    uint32_t poll(const GameManagerPoolAccess& poolAccess, uint32_t maximum);
+
+    /**
+     * @brief Gets the current target concurrency.
+     */
+    [[nodiscard]] uint32_t target() const { return target_; }
+
+    /**
+     * @brief Calculates the next concurrency from the measurements.
+     * @param current Current concurrency.
+     * @param maximum Upper limit for the concurrency.
+     * @param measurement Measurements since the last change.
+     * @return The next concurrency, between 1 and maximum.
+     */
+    [[nodiscard]] static uint32_t decide(uint32_t current, uint32_t maximum, const Measurement& measurement);
+
+    /**
+     * @brief Checks if a move played with a clock overshoots.
+     * @param timeMs Time used for the move.
+     * @param clockMs Clock of the engine after the move, negative if it lost on time.
+     * @param incrementMs Increment of the engine's time control.
+     * @return true, if the move used more than the clock left after it plus one increment.
+     */
+    [[nodiscard]] static bool isClockOvershoot(uint64_t timeMs, int64_t clockMs, uint64_t incrementMs);
+
+private:
+    struct SlotState {
+        std::string gameId;
+        size_t moves = 0;
+        bool finished = false;
+        uint64_t whiteUsedMs = 0;  ///< Clock time used by white so far
+        uint64_t blackUsedMs = 0;  ///< Clock time used by black so far
+    };
+
+    void sampleGames(const GameManagerPoolAccess& poolAccess);
+    std::optional<double> sampleCpuLoad();
+
+    /**
+     * @brief Sums the measurements of the evaluation intervals in the window.
+     */
+    [[nodiscard]] Measurement windowMeasurement() const;
+
+    uint32_t target_ = 0;
+    Measurement interval_;               ///< Measurements of the running evaluation interval
+    std::deque<Measurement> window_;     ///< Last evaluation intervals at the current concurrency
+    std::unordered_map<uint32_t, SlotState> slots_;
+    std::optional<std::pair<uint64_t, uint64_t>> lastCpuTimes_;
+    std::chrono::steady_clock::time_point lastSample_;
+    std::chrono::steady_clock::time_point lastEvaluation_;
+};
+
+} // namespace QaplaWindows
@@ -0,0 +1,135 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "adjudication-simulator-window.h"
+#include "imgui-controls.h"
+
+#include <base-elements/string-helper.h>
+
+#include <imgui.h>
+
+#include <format>
+
+namespace QaplaWindows {
+
+namespace {
+    std::vector<uint32_t> toUnsigned(const std::vector<int>& values) {
+        std::vector<uint32_t> result;
+        for (auto value : values) {
+            if (value >= 0) {
+                result.push_back(static_cast<uint32_t>(value));
+            }
+        }
+        return result;
+    }
+
+    std::string formatPercent(uint32_t part, uint32_t total) {
+        if (total == 0) {
+            return "-";
+        }
+        return std::format("{} ({:.1f}%)", part, 100.0 * part / total);
+    }
+}
+
+AdjudicationSimulatorWindow::AdjudicationSimulatorWindow()
+    : resultTable_(
+        "AdjudicationWhatIf",
+        ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY,
+        std::vector<ImGuiTable::ColumnDef>{
+            { .name = "Adjudicate", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 80.0F },
+            { .name = "Threshold", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 70.0F, .alignRight = true },
+            { .name = "Moves", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 50.0F, .alignRight = true },
+            { .name = "Min moves", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 70.0F, .alignRight = true },
+            { .name = "Total", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 50.0F, .alignRight = true },
+            { .name = "Correct", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 90.0F, .alignRight = true },
+            { .name = "Incorrect", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 90.0F, .alignRight = true },
+            { .name = "Saveable", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 80.0F, .alignRight = true },
+            { .name = "Total Time", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 80.0F, .alignRight = true }
+        })
+{
+    resultTable_.setSortable(true);
+}
+
+void AdjudicationSimulatorWindow::draw() {
+    constexpr float inputWidth = 200.0F;
+
+    ImGui::TextWrapped("Replays the loaded games with their evaluations through the draw and resign "
+        "adjudication rules for every combination of the values below.");
+    ImGui::Spacing();
+
+    ImGui::SetNextItemWidth(inputWidth);
+    ImGuiControls::inputText("Draw thresholds", drawThresholds_);
+    ImGuiControls::hooverTooltip("Centipawn thresholds to try for draw adjudication, separated by commas");
+    ImGui::SetNextItemWidth(inputWidth);
+    ImGuiControls::inputText("Resign thresholds", resignThresholds_);
+    ImGuiControls::hooverTooltip("Centipawn thresholds to try for resign adjudication, separated by commas");
+    ImGui::SetNextItemWidth(inputWidth);
+    ImGuiControls::inputText("Required consecutive moves", consecutiveMoves_);
+    ImGuiControls::hooverTooltip("Numbers of consecutive moves to try for both rules, separated by commas");
+    ImGui::SetNextItemWidth(inputWidth);
+    ImGuiControls::inputText("Min full moves", minFullMoves_);
+    ImGuiControls::hooverTooltip("Minimum numbers of full moves to try for draw adjudication, separated by commas");
+    ImGuiControls::checkbox("Both side decides", twoSidedResign_);
+    ImGuiControls::hooverTooltip("Require both engines to agree position is lost before adjudicating resign");
+
+    ImGui::Spacing();
+    if (!resultMutex_.try_lock()) {
+        ImGui::TextDisabled("Updating results...");
+        return;
+    }
+    std::lock_guard lock(resultMutex_, std::adopt_lock); // NOLINT(modernize-use-scoped-lock)
+    if (resultTable_.size() == 0) {
+        return;
+    }
+    ImGui::Text("Simulated %zu games", gameCount_);
+    resultTable_.draw(ImVec2(0, ImGui::GetContentRegionAvail().y));
+}
+
+AdjudicationSimulator::Grid AdjudicationSimulatorWindow::grid() const {
+    return AdjudicationSimulator::Grid{
+        .drawThresholds = AdjudicationSimulator::parseList(drawThresholds_),
+        .resignThresholds = AdjudicationSimulator::parseList(resignThresholds_),
+        .consecutiveMoves = toUnsigned(AdjudicationSimulator::parseList(consecutiveMoves_)),
+        .minFullMoves = toUnsigned(AdjudicationSimulator::parseList(minFullMoves_)),
+        .twoSidedResign = twoSidedResign_
+    };
+}
+
+void AdjudicationSimulatorWindow::setResults(const std::vector<AdjudicationSimulator::Row>& rows, size_t gameCount) {
+    std::scoped_lock lock(resultMutex_);
+    gameCount_ = gameCount;
+    resultTable_.clear();
+    for (const auto& row : rows) {
+        const bool draw = row.rule == AdjudicationSimulator::Rule::Draw;
+        const auto& outcome = row.outcome;
+        resultTable_.push({
+            draw ? "Draw" : "Resign",
+            std::to_string(row.setting.centipawnThreshold),
+            std::to_string(row.setting.requiredConsecutiveMoves),
+            draw ? std::to_string(row.setting.minFullMoves) : "-",
+            std::to_string(outcome.total),
+            formatPercent(outcome.correct, outcome.total),
+            formatPercent(outcome.incorrect, outcome.total),
+            QaplaHelpers::formatMs(outcome.savedMs, 0),
+            QaplaHelpers::formatMs(outcome.totalMs, 0)
+        });
+    }
+}
+
+} // namespace QaplaWindows
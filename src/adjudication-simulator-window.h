@@ -0,0 +1,72 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "embedded-window.h"
+#include "adjudication-simulator.h"
+#include "imgui-table.h"
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Popup content for the adjudication "what if" simulation of the game list.
+ * 
+ * Holds the grid of adjudication settings to try and shows the simulated outcome of 
+ * every setting. Results are set from the simulation thread.
+ */
+class AdjudicationSimulatorWindow : public EmbeddedWindow {
+public:
+    AdjudicationSimulatorWindow();
+
+    /**
+     * @brief Draws the grid inputs and the results of the last simulation.
+     */
+    void draw() override;
+
+    /**
+     * @brief Gets the settings grid entered by the user.
+     */
+    [[nodiscard]] AdjudicationSimulator::Grid grid() const;
+
+    /**
+     * @brief Sets the results of a simulation. Thread safe.
+     * @param rows Simulated settings with their outcomes.
+     * @param gameCount Number of simulated games.
+     */
+    void setResults(const std::vector<AdjudicationSimulator::Row>& rows, size_t gameCount);
+
+private:
+    std::string drawThresholds_ = "5, 10, 20";
+    std::string resignThresholds_ = "400, 600, 1000";
+    std::string consecutiveMoves_ = "4, 8, 12";
+    std::string minFullMoves_ = "30, 40, 60";
+    bool twoSidedResign_ = false;
+
+    std::mutex resultMutex_;
+    ImGuiTable resultTable_;
+    size_t gameCount_ = 0;
+};
+
+} // namespace QaplaWindows
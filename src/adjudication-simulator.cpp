@@ -0,0 +1,289 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "adjudication-simulator.h"
+
+#include <chess-game/game-record.h>
+#include <opening/pgn-io.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <thread>
+
+using QaplaTester::GameRecord;
+using QaplaTester::GameResult;
+using QaplaTester::PgnIO;
+
+namespace QaplaWindows {
+
+namespace {
+    /**
+     * Splits [0, count) into at most threads ranges and runs the function on each range in parallel.
+     */
+    template <typename Function>
+    auto forEachRange(size_t count, uint32_t threads, Function function) {
+        using Result = decltype(function(size_t{}, size_t{}));
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        const size_t chunks = std::max<size_t>(1, std::min<size_t>(threads, count));
+        const size_t chunkSize = (count + chunks - 1) / chunks;
+        std::vector<std::future<Result>> futures;
+        for (size_t begin = 0; begin < count; begin += chunkSize) {
+            futures.push_back(std::async(std::launch::async, function, begin, std::min(count, begin + chunkSize)));
+        }
+        std::vector<Result> results;
+        results.reserve(futures.size());
+        for (auto& future : futures) {
+            results.push_back(future.get());
+        }
+        return results;
+    }
+
+    bool whiteMovesAt(const AdjudicationSimulator::GameEvals& game, size_t ply) {
+        return (ply % 2 == 0) == game.whiteStarts;
+    }
+
+    uint32_t fullMoveAt(const AdjudicationSimulator::GameEvals& game, size_t ply) {
+        return static_cast<uint32_t>((game.whiteStarts ? ply : ply + 1) / 2 + 1);
+    }
+
+    std::vector<AdjudicationSimulator::GameEvals> join(std::vector<std::vector<AdjudicationSimulator::GameEvals>>& parts) {
+        std::vector<AdjudicationSimulator::GameEvals> games;
+        for (auto& part : parts) {
+            std::ranges::move(part, std::back_inserter(games));
+        }
+        return games;
+    }
+
+    void account(AdjudicationSimulator::Outcome& outcome, const AdjudicationSimulator::GameEvals& game,
+        size_t ply, GameResult adjudicated) {
+        outcome.total++;
+        if (adjudicated == game.result) {
+            outcome.correct++;
+        } else {
+            outcome.incorrect++;
+        }
+        for (size_t later = ply + 1; later < game.timesMs.size(); ++later) {
+            outcome.savedMs += game.timesMs[later];
+        }
+    }
+}
+
+std::vector<AdjudicationSimulator::Row> AdjudicationSimulator::Grid::rows() const {
+    std::vector<Row> result;
+    for (auto threshold : drawThresholds) {
+        for (auto moves : consecutiveMoves) {
+            for (auto minMoves : minFullMoves) {
+                result.push_back(Row{ .rule = Rule::Draw, .setting = { threshold, moves, minMoves }, .outcome = {} });
+            }
+        }
+    }
+    for (auto threshold : resignThresholds) {
+        for (auto moves : consecutiveMoves) {
+            result.push_back(Row{ .rule = Rule::Resign, .setting = { threshold, moves, 0 }, .outcome = {} });
+        }
+    }
+    if (result.size() > MAX_ROWS) {
+        result.resize(MAX_ROWS);
+    }
+    return result;
+}
+
+AdjudicationSimulator::GameEvals AdjudicationSimulator::extract(const GameRecord& game) {
+    GameEvals evals;
+    const auto& history = game.history();
+    evals.scores.reserve(history.size());
+    evals.timesMs.reserve(history.size());
+    evals.whiteStarts = history.empty() || game.wtmAtPly(0);
+    evals.result = game.getGameResult().second;
+    for (const auto& move : history) {
+        std::optional<int> score;
+        if (move.scoreMate) {
+            score = *move.scoreMate > 0 ? MATE_SCORE : -MATE_SCORE;
+        } else if (move.scoreCp) {
+            score = static_cast<int>(*move.scoreCp);
+        }
+        evals.scores.push_back(score);
+        evals.timesMs.push_back(move.timeMs);
+    }
+    return evals;
+}
+
+std::vector<AdjudicationSimulator::GameEvals> AdjudicationSimulator::loadPgn(const std::string& fileName,
+    const std::vector<std::streampos>& positions, const std::function<bool()>& cancelCheck, 
+    std::atomic<size_t>& loaded) 
+{
+    auto parts = forEachRange(positions.size(), 0, [&](size_t begin, size_t end) {
+        std::vector<GameEvals> games;
+        std::ifstream in(fileName, std::ios::binary);
+        if (!in) {
+            return games;
+        }
+        in.seekg(0, std::ios::end);
+        const auto fileEnd = in.tellg();
+        std::string text;
+        for (size_t index = begin; index < end && !cancelCheck(); ++index) {
+            const auto from = positions[index];
+            const auto to = index + 1 < positions.size() ? positions[index + 1] : fileEnd;
+            loaded++;
+            if (to <= from) {
+                continue;
+            }
+            text.resize(static_cast<size_t>(to - from));
+            in.seekg(from);
+            in.read(text.data(), static_cast<std::streamsize>(text.size()));
+            auto evals = extract(PgnIO::parseGame(text));
+            if (evals.result != GameResult::Unterminated) {
+                games.push_back(std::move(evals));
+            }
+        }
+        return games;
+    });
+    return join(parts);
+}
+
+std::vector<AdjudicationSimulator::GameEvals> AdjudicationSimulator::loadIndexed(size_t count,
+    const std::function<std::optional<GameRecord>(size_t)>& loadGame,
+    const std::function<bool()>& cancelCheck, std::atomic<size_t>& loaded) 
+{
+    auto parts = forEachRange(count, 0, [&](size_t begin, size_t end) {
+        std::vector<GameEvals> games;
+        for (size_t index = begin; index < end && !cancelCheck(); ++index) {
+            loaded++;
+            auto game = loadGame(index);
+            if (!game) {
+                continue;
+            }
+            auto evals = extract(*game);
+            if (evals.result != GameResult::Unterminated) {
+                games.push_back(std::move(evals));
+            }
+        }
+        return games;
+    });
+    return join(parts);
+}
+
+std::optional<size_t> AdjudicationSimulator::drawPly(const GameEvals& game, const Setting& setting) {
+    // Both sides must stay within the threshold, so a move pair counts as one move
+    const uint32_t requiredPlies = std::max(1U, setting.requiredConsecutiveMoves * 2);
+    const int threshold = std::abs(setting.centipawnThreshold);
+    uint32_t count = 0;
+    for (size_t ply = 0; ply < game.scores.size(); ++ply) {
+        const auto& score = game.scores[ply];
+        if (!score || std::abs(*score) > threshold) {
+            count = 0;
+            continue;
+        }
+        count++;
+        if (count >= requiredPlies && fullMoveAt(game, ply) >= setting.minFullMoves) {
+            return ply;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::pair<size_t, GameResult>> AdjudicationSimulator::resignPly(
+    const GameEvals& game, const Setting& setting, bool twoSided) 
+{
+    const uint32_t required = std::max(1U, setting.requiredConsecutiveMoves);
+    const int threshold = std::abs(setting.centipawnThreshold);
+    // Index 0 is white, index 1 is black
+    std::array<uint32_t, 2> losing{};
+    std::array<uint32_t, 2> winning{};
+    for (size_t ply = 0; ply < game.scores.size(); ++ply) {
+        const size_t side = whiteMovesAt(game, ply) ? 0 : 1;
+        const auto& score = game.scores[ply];
+        losing[side] = score && *score <= -threshold ? losing[side] + 1 : 0;
+        winning[side] = score && *score >= threshold ? winning[side] + 1 : 0;
+        for (size_t loser = 0; loser < 2; ++loser) {
+            if (losing[loser] >= required && (!twoSided || winning[1 - loser] >= required)) {
+                return std::pair{ ply, loser == 0 ? GameResult::BlackWins : GameResult::WhiteWins };
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void AdjudicationSimulator::simulate(const std::vector<GameEvals>& games, std::vector<Row>& rows, 
+    bool twoSided, uint32_t threads) 
+{
+    auto parts = forEachRange(games.size(), threads, [&](size_t begin, size_t end) {
+        std::vector<Outcome> outcomes(rows.size());
+        for (size_t index = begin; index < end; ++index) {
+            const auto& game = games[index];
+            uint64_t gameMs = 0;
+            for (auto time : game.timesMs) {
+                gameMs += time;
+            }
+            for (size_t row = 0; row < rows.size(); ++row) {
+                auto& outcome = outcomes[row];
+                outcome.totalMs += gameMs;
+                const auto& setting = rows[row].setting;
+                if (rows[row].rule == Rule::Draw) {
+                    if (auto ply = drawPly(game, setting)) {
+                        account(outcome, game, *ply, GameResult::Draw);
+                    }
+                } else if (auto adjudication = resignPly(game, setting, twoSided)) {
+                    account(outcome, game, adjudication->first, adjudication->second);
+                }
+            }
+        }
+        return outcomes;
+    });
+
+    for (const auto& part : parts) {
+        for (size_t row = 0; row < rows.size(); ++row) {
+            auto& outcome = rows[row].outcome;
+            outcome.total += part[row].total;
+            outcome.correct += part[row].correct;
+            outcome.incorrect += part[row].incorrect;
+            outcome.savedMs += part[row].savedMs;
+            outcome.totalMs += part[row].totalMs;
+        }
+    }
+}
+
+std::vector<int> AdjudicationSimulator::parseList(std::string_view text) {
+    std::vector<int> values;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        auto end = text.find_first_of(", ;", pos);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        auto token = text.substr(pos, end - pos);
+        int value = 0;
+        auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (!token.empty() && ec == std::errc{} && ptr == token.data() + token.size()
+            && std::ranges::find(values, value) == values.end()) {
+            values.push_back(value);
+        }
+        pos = end + 1;
+    }
+    return values;
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,163 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <chess-game/game-result.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <ios>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QaplaTester {
+    class GameRecord;
+}
+
+namespace QaplaWindows {
+
+/**
+ * @brief Replays archived games through draw and resign adjudication rules.
+ * 
+ * Answers "what if" questions for the adjudication settings: for every setting of a grid
+ * it reports how many games would have been adjudicated, how many of them with the 
+ * played result and how much engine time the adjudication would have saved. Only the 
+ * evaluations, move times and results of the games are kept, so large archives fit 
+ * into memory. Loading and simulation run in parallel.
+ */
+class AdjudicationSimulator {
+public:
+    enum class Rule {
+        Draw,
+        Resign
+    };
+
+    /**
+     * @brief Compact form of a game holding the data needed for adjudication.
+     */
+    struct GameEvals {
+        std::vector<std::optional<int>> scores;   ///< Per ply, from the view of the moving side
+        std::vector<uint64_t> timesMs;            ///< Per ply
+        bool whiteStarts = true;
+        QaplaTester::GameResult result = QaplaTester::GameResult::Unterminated;
+    };
+
+    struct Setting {
+        int centipawnThreshold = 0;
+        uint32_t requiredConsecutiveMoves = 0;
+        uint32_t minFullMoves = 0;                ///< Draw rule only
+    };
+
+    struct Outcome {
+        uint32_t total = 0;        ///< Adjudicated games
+        uint32_t correct = 0;      ///< Adjudicated with the played result
+        uint32_t incorrect = 0;
+        uint64_t savedMs = 0;      ///< Engine time after the adjudicated move
+        uint64_t totalMs = 0;      ///< Engine time of all simulated games
+    };
+
+    struct Row {
+        Rule rule = Rule::Draw;
+        Setting setting;
+        Outcome outcome;
+    };
+
+    struct Grid {
+        std::vector<int> drawThresholds;
+        std::vector<int> resignThresholds;
+        std::vector<uint32_t> consecutiveMoves;
+        std::vector<uint32_t> minFullMoves;
+        bool twoSidedResign = false;
+
+        /**
+         * @brief Expands the grid to the settings of both rules.
+         * Resign settings ignore the minimal number of full moves.
+         */
+        [[nodiscard]] std::vector<Row> rows() const;
+    };
+
+    /// Score used for mate announcements
+    static constexpr int MATE_SCORE = 100000;
+    /// Upper limit of simulated settings
+    static constexpr size_t MAX_ROWS = 2000;
+
+    /**
+     * @brief Extracts the adjudication data of a game.
+     */
+    [[nodiscard]] static GameEvals extract(const QaplaTester::GameRecord& game);
+
+    /**
+     * @brief Loads the games of a PGN file in parallel, each thread parsing its own 
+     * range of games.
+     * @param fileName PGN file.
+     * @param positions Start offsets of the games in the file.
+     * @param cancelCheck Thread safe function returning true to stop loading.
+     * @param loaded Number of games loaded so far, updated while loading.
+     * @return The finished games with their evaluations.
+     */
+    [[nodiscard]] static std::vector<GameEvals> loadPgn(const std::string& fileName,
+        const std::vector<std::streampos>& positions, const std::function<bool()>& cancelCheck, 
+        std::atomic<size_t>& loaded);
+
+    /**
+     * @brief Loads games by index in parallel.
+     * @param count Number of games.
+     * @param loadGame Thread safe function loading a game completely, including evaluations.
+     * @param cancelCheck Thread safe function returning true to stop loading.
+     * @param loaded Number of games loaded so far, updated while loading.
+     * @return The finished games with their evaluations.
+     */
+    [[nodiscard]] static std::vector<GameEvals> loadIndexed(size_t count,
+        const std::function<std::optional<QaplaTester::GameRecord>(size_t)>& loadGame,
+        const std::function<bool()>& cancelCheck, std::atomic<size_t>& loaded);
+
+    /**
+     * @brief Gets the ply at which the draw rule adjudicates a game.
+     * @return The ply, or std::nullopt if the rule never triggers.
+     */
+    [[nodiscard]] static std::optional<size_t> drawPly(const GameEvals& game, const Setting& setting);
+
+    /**
+     * @brief Gets the ply at which the resign rule adjudicates a game and the result it assigns.
+     * @param twoSided If true, the winning side must agree with its own evaluation.
+     */
+    [[nodiscard]] static std::optional<std::pair<size_t, QaplaTester::GameResult>> resignPly(
+        const GameEvals& game, const Setting& setting, bool twoSided);
+
+    /**
+     * @brief Simulates all rows over all games, splitting the games on several threads.
+     * @param games Games to replay.
+     * @param rows Settings to simulate, outcomes are added.
+     * @param twoSided Two sided resign rule.
+     * @param threads Number of threads, zero uses the hardware concurrency.
+     */
+    static void simulate(const std::vector<GameEvals>& games, std::vector<Row>& rows, 
+        bool twoSided, uint32_t threads = 0);
+
+    /**
+     * @brief Parses a list of integers separated by commas or blanks. Invalid entries are skipped.
+     */
+    [[nodiscard]] static std::vector<int> parseList(std::string_view text);
+};
+
+} // namespace QaplaWindows
@@ -3,6 +3,8 @@
 #include "../extern/stb/stb_image.h"
 #include <stdexcept>
 #include <iostream>
+#include <future>
+#include <chrono>
 
 static GLuint backgroundTexture{};
 static GLuint backgroundVAO{}, backgroundVBO{}, backgroundEBO{};
@@ -10,6 +12,15 @@ static GLuint backgroundShaderProgram{};
 
 bool backgroundImageLoaded = false;
 
+struct DecodedImage {
+    unsigned char* data = nullptr;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+};
+
+static std::future<DecodedImage> pendingBackgroundImage;
+
 static const char* vertexShaderSource = R"(
 #version 330 core
 layout (location = 0) in vec2 aPos;
@@ -103,36 +114,68 @@ static void initBackgroundGeometryAndShaders() {
 }
 
 /**
- * Initializes background image from memory array.
- * Must be called after OpenGL context is active.
+ * Decodes image data from memory, may run on any thread.
  */
-void initBackgroundImageFromMemory(const void* imageData, unsigned int dataSize) {
-    // Load image from memory
-    int texWidth{}, texHeight{}, channels{};
-    unsigned char* data = stbi_load_from_memory(
+static DecodedImage decodeImageFromMemory(const void* imageData, unsigned int dataSize) {
+    DecodedImage image;
+    image.data = stbi_load_from_memory(
         static_cast<const unsigned char*>(imageData), 
         static_cast<int>(dataSize), 
-        &texWidth, 
-        &texHeight, 
-        &channels, 
+        &image.width, 
+        &image.height, 
+        &image.channels, 
         0
     );
-    if (!data) throw std::runtime_error("Failed to load background image from memory");
+    if (!image.data) throw std::runtime_error("Failed to load background image from memory");
+    return image;
+}
 
-    GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
+/**
+ * Uploads a decoded image as background texture and frees the pixel data.
+ * Must be called with the OpenGL context active.
+ */
+static void uploadBackgroundImage(const DecodedImage& image) {
+    GLenum format = (image.channels == 4) ? GL_RGBA : GL_RGB;
 
     // Upload texture
     glGenTextures(1, &backgroundTexture);
     glBindTexture(GL_TEXTURE_2D, backgroundTexture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, format, texWidth, texHeight, 0, format, GL_UNSIGNED_BYTE, data);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.data);
     glBindTexture(GL_TEXTURE_2D, 0);
-    stbi_image_free(data);
+    stbi_image_free(image.data);
 
     initBackgroundGeometryAndShaders();
 }
 
+/**
+ * Initializes background image from memory array.
+ * Must be called after OpenGL context is active.
+ */
+void initBackgroundImageFromMemory(const void* imageData, unsigned int dataSize) {
+    uploadBackgroundImage(decodeImageFromMemory(imageData, dataSize));
+}
+
+void startBackgroundImageFromMemory(const void* imageData, unsigned int dataSize) {
+    pendingBackgroundImage = std::async(std::launch::async, decodeImageFromMemory, imageData, dataSize);
+}
+
+/**
+ * Uploads the image decoded by startBackgroundImageFromMemory once it is ready.
+ */
+static void uploadPendingBackgroundImage() {
+    if (!pendingBackgroundImage.valid() 
+        || pendingBackgroundImage.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+    try {
+        uploadBackgroundImage(pendingBackgroundImage.get());
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: Failed to load background image: " << e.what() << "\n";
+    }
+}
+
 /**
  * Initializes background image from file.
  * Must be called after OpenGL context is active.
@@ -161,6 +204,9 @@ void initBackgroundImage(const char* imagePath) {
  * Draws the fullscreen background image. Call once per frame before ImGui::NewFrame().
  */
 void drawBackgroundImage() {
+    if (!backgroundImageLoaded) {
+        uploadPendingBackgroundImage();
+    }
     if (!backgroundImageLoaded) return;
 
     glUseProgram(backgroundShaderProgram);
@@ -9,6 +9,16 @@
  */
 void initBackgroundImageFromMemory(const void* imageData, unsigned int dataSize);
 
+/**
+ * Starts decoding the background image from memory on a worker thread.
+ * The texture, quad, and shaders are created by the first drawBackgroundImage call
+ * after decoding has finished, so the startup does not wait for the decoder.
+ * 
+ * @param imageData Pointer to image data in memory (JPEG/PNG format), must stay valid.
+ * @param dataSize Size of image data in bytes.
+ */
+void startBackgroundImageFromMemory(const void* imageData, unsigned int dataSize);
+
 /**
  * Initializes background image, quad, and shaders from file.
  * Must be called after OpenGL context is active.
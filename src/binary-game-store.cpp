@@ -0,0 +1,665 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "binary-game-store.h"
+
+#include <base-elements/logger.h>
+#include <game-manager/game-state.h>
+#include <opening/pgn-io.h>
+
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+#include <map>
+#include <thread>
+
+using QaplaTester::GameRecord;
+using QaplaTester::GameResult;
+using QaplaTester::GameState;
+using QaplaTester::Logger;
+using QaplaTester::MoveRecord;
+using QaplaTester::PgnIO;
+using QaplaTester::TraceLevel;
+
+namespace QaplaWindows {
+
+namespace {
+
+    constexpr std::string_view FILE_MAGIC = "QGB1";
+    constexpr std::string_view FOOTER_MAGIC = "QGBE";
+    constexpr uint32_t FORMAT_VERSION = 1;
+    constexpr size_t HEADER_SIZE = 8;
+    constexpr size_t FOOTER_SIZE = 12;
+    constexpr uint32_t GAMES_PER_BLOCK = 4096;
+    /// Size varint, tag count, start position, move count and flags take at least one byte each
+    constexpr uint64_t MIN_GAME_SIZE = 5;
+    constexpr const char* STORE_EXTENSION = ".qgb";
+
+    constexpr uint8_t FLAG_CLOCKS = 0x01;
+    constexpr uint8_t FLAG_EVALS = 0x02;
+
+    enum class EvalKind : uint8_t { None = 0, Centipawns = 1, Mate = 2 };
+
+    void putVarint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    void putZigzag(std::string& out, int64_t value) {
+        putVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void putFixed(std::string& out, uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    /**
+     * @brief Bounds checked reader over an encoded byte range.
+     */
+    class ByteReader {
+    public:
+        explicit ByteReader(std::string_view data) : data_(data) {}
+
+        uint64_t varint() {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                auto byte = static_cast<uint8_t>(next());
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return value;
+                }
+            }
+            throw std::runtime_error("Corrupt game store: invalid number encoding");
+        }
+
+        int64_t zigzag() {
+            uint64_t value = varint();
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        uint64_t fixed(size_t bytes) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < bytes; ++i) {
+                value |= static_cast<uint64_t>(static_cast<uint8_t>(next())) << (8 * i);
+            }
+            return value;
+        }
+
+        std::string_view bytes(size_t count) {
+            if (count > data_.size() - pos_) {
+                throw std::runtime_error("Corrupt game store: unexpected end of data");
+            }
+            auto result = data_.substr(pos_, count);
+            pos_ += count;
+            return result;
+        }
+
+        [[nodiscard]] size_t position() const { return pos_; }
+
+    private:
+        char next() {
+            if (pos_ >= data_.size()) {
+                throw std::runtime_error("Corrupt game store: unexpected end of data");
+            }
+            return data_[pos_++];
+        }
+
+        std::string_view data_;
+        size_t pos_ = 0;
+    };
+
+    std::string readFileRange(std::ifstream& in, uint64_t offset, uint64_t size) {
+        std::string buffer(size, '\0');
+        in.clear();
+        in.seekg(static_cast<std::streamoff>(offset));
+        in.read(buffer.data(), static_cast<std::streamsize>(size));
+        if (static_cast<uint64_t>(in.gcount()) != size) {
+            throw std::runtime_error("Corrupt game store: file truncated");
+        }
+        return buffer;
+    }
+
+    void appendEscapedTag(std::string& out, const std::string& name, const std::string& value) {
+        out += '[';
+        out += name;
+        out += " \"";
+        for (char ch : value) {
+            if (ch == '"' || ch == '\\') {
+                out += '\\';
+            }
+            out += ch;
+        }
+        out += "\"]\n";
+    }
+
+    GameResult parseResult(const std::string& result) {
+        if (result == "1-0") {
+            return GameResult::WhiteWins;
+        }
+        if (result == "0-1") {
+            return GameResult::BlackWins;
+        }
+        if (result == "1/2-1/2") {
+            return GameResult::Draw;
+        }
+        return GameResult::Unterminated;
+    }
+
+    void setStartPosition(GameState& gameState, const GameRecord& game) {
+        if (game.getStartPos() || game.getStartFen().empty()) {
+            gameState.setFen(true);
+        } else {
+            gameState.setFen(false, game.getStartFen());
+        }
+    }
+
+    template <typename T>
+    void assignValue(T& target, int64_t value) {
+        target = static_cast<T>(value);
+    }
+
+    template <typename T>
+    void assignValue(std::optional<T>& target, int64_t value) {
+        target = static_cast<T>(value);
+    }
+
+    /**
+     * @brief Decodes a stored game.
+     * @param data Encoded game bytes.
+     * @param dictionary String dictionary of the store.
+     * @param complete If true, the header is parsed like a PGN header, moves are replayed to get 
+     *        SAN notation and side streams are set; otherwise only tags, start position and result 
+     *        are set and moves only carry their long algebraic notation.
+     */
+    GameRecord decodeGame(std::string_view data, const std::vector<std::string>& dictionary, bool complete) {
+        ByteReader reader(data);
+        auto lookup = [&](uint64_t id) -> const std::string& {
+            if (id >= dictionary.size()) {
+                throw std::runtime_error("Corrupt game store: invalid dictionary id");
+            }
+            return dictionary[id];
+        };
+
+        std::map<std::string, std::string> tags;
+        auto tagCount = reader.varint();
+        for (uint64_t i = 0; i < tagCount; ++i) {
+            const auto& name = lookup(reader.varint());
+            tags[name] = lookup(reader.varint());
+        }
+        auto fenId = reader.varint();
+        if (fenId != 0 && !tags.contains("FEN")) {
+            tags["SetUp"] = "1";
+            tags["FEN"] = lookup(fenId - 1);
+        }
+        auto resultTag = tags.find("Result");
+        const std::string result = resultTag != tags.end() ? resultTag->second : "*";
+
+        GameRecord game;
+        if (complete) {
+            // A single game is parsed by PgnIO, so it carries everything a loaded PGN game carries
+            std::string header;
+            for (const auto& [name, value] : tags) {
+                appendEscapedTag(header, name, value);
+            }
+            header += '\n';
+            header += result;
+            header += '\n';
+            game = PgnIO::parseGame(header);
+        } else {
+            auto fenTag = tags.find("FEN");
+            if (fenTag != tags.end()) {
+                GameState gameState;
+                gameState.setFen(false, fenTag->second);
+                game.setStartPosition(false, fenTag->second, 
+                    gameState.isWhiteToMove(), gameState.getStartHalfmoves());
+            }
+            game.setTags(tags);
+            game.setGameEnd(std::get<0>(game.getGameResult()), parseResult(result));
+        }
+
+        auto moveCount = reader.varint();
+        auto moveBytes = reader.bytes(moveCount * 2);
+        auto flags = static_cast<uint8_t>(reader.bytes(1)[0]);
+
+        std::vector<MoveRecord> moves(moveCount);
+        for (size_t i = 0; i < moveCount; ++i) {
+            auto code = static_cast<uint16_t>(static_cast<uint8_t>(moveBytes[2 * i]) 
+                | (static_cast<uint8_t>(moveBytes[2 * i + 1]) << 8));
+            moves[i].lan_ = BinaryMoveCodec::decode(code);
+        }
+        if ((flags & FLAG_CLOCKS) != 0) {
+            for (auto& move : moves) {
+                assignValue(move.timeMs, static_cast<int64_t>(reader.varint()));
+            }
+        }
+        if ((flags & FLAG_EVALS) != 0) {
+            for (auto& move : moves) {
+                auto kind = static_cast<EvalKind>(reader.bytes(1)[0]);
+                if (kind == EvalKind::Centipawns) {
+                    assignValue(move.scoreCp, reader.zigzag());
+                } else if (kind == EvalKind::Mate) {
+                    assignValue(move.scoreMate, reader.zigzag());
+                }
+                assignValue(move.depth, static_cast<int64_t>(reader.varint()));
+            }
+        }
+
+        if (!complete) {
+            for (auto& move : moves) {
+                game.addMove(move);
+            }
+            return game;
+        }
+
+        GameState gameState;
+        setStartPosition(gameState, game);
+        for (auto& move : moves) {
+            auto parsed = gameState.stringToMove(move.lan_, false);
+            if (parsed.isEmpty()) {
+                break;
+            }
+            move.lan_ = parsed.getLAN();
+            move.san_ = gameState.moveToSan(parsed);
+            move.original = move.san_;
+            gameState.doMove(parsed);
+            game.addMove(move);
+        }
+        return game;
+    }
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Move codec
+// ------------------------------------------------------------------------------------------------
+
+namespace BinaryMoveCodec {
+
+    static std::optional<uint16_t> parseSquare(char file, char rank) {
+        if (file < 'a' || file > 'h' || rank < '1' || rank > '8') {
+            return std::nullopt;
+        }
+        return static_cast<uint16_t>((rank - '1') * 8 + (file - 'a'));
+    }
+
+    std::optional<uint16_t> encode(std::string_view lan) {
+        constexpr std::string_view promotions = "nbrq";
+        if (lan.size() != 4 && lan.size() != 5) {
+            return std::nullopt;
+        }
+        auto from = parseSquare(lan[0], lan[1]);
+        auto to = parseSquare(lan[2], lan[3]);
+        if (!from || !to) {
+            return std::nullopt;
+        }
+        uint16_t promotion = 0;
+        if (lan.size() == 5) {
+            auto piece = static_cast<char>(std::tolower(static_cast<unsigned char>(lan[4])));
+            auto pos = promotions.find(piece);
+            if (pos == std::string_view::npos) {
+                return std::nullopt;
+            }
+            promotion = static_cast<uint16_t>(pos + 1);
+        }
+        return static_cast<uint16_t>(*from | (*to << 6) | (promotion << 12));
+    }
+
+    std::string decode(uint16_t code) {
+        constexpr std::string_view promotions = " nbrq";
+        auto square = [](uint16_t index) {
+            return std::string{ static_cast<char>('a' + index % 8), static_cast<char>('1' + index / 8) };
+        };
+        std::string lan = square(code & 0x3F) + square((code >> 6) & 0x3F);
+        uint16_t promotion = (code >> 12) & 0x07;
+        if (promotion > 0 && promotion < promotions.size()) {
+            lan += promotions[promotion];
+        }
+        return lan;
+    }
+
+} // namespace BinaryMoveCodec
+
+// ------------------------------------------------------------------------------------------------
+// Writer
+// ------------------------------------------------------------------------------------------------
+
+BinaryGameWriter::BinaryGameWriter(const std::string& fileName)
+    : fileName_(fileName), out_(fileName, std::ios::trunc | std::ios::binary) {
+    if (!out_.is_open()) {
+        throw std::runtime_error(std::format("Failed to open file for writing: {}", fileName));
+    }
+    std::string header(FILE_MAGIC);
+    putFixed(header, FORMAT_VERSION, 4);
+    out_.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+BinaryGameWriter::~BinaryGameWriter() {
+    try {
+        finish();
+    } catch (...) {
+        // Destructor must not throw, errors are reported by explicit finish() calls
+    }
+}
+
+uint32_t BinaryGameWriter::stringId(const std::string& text) {
+    auto [it, inserted] = dictionaryIds_.try_emplace(text, static_cast<uint32_t>(dictionary_.size()));
+    if (inserted) {
+        dictionary_.push_back(text);
+    }
+    return it->second;
+}
+
+bool BinaryGameWriter::addGame(const GameRecord& game) {
+    std::string encoded;
+    const auto& tags = game.getTags();
+    putVarint(encoded, tags.size());
+    for (const auto& [name, value] : tags) {
+        putVarint(encoded, stringId(name));
+        putVarint(encoded, stringId(value));
+    }
+    bool customStart = !game.getStartPos() && !game.getStartFen().empty();
+    putVarint(encoded, customStart ? stringId(game.getStartFen()) + 1 : 0);
+
+    // Replay the moves, PGN games may only carry SAN notation
+    GameState gameState;
+    setStartPosition(gameState, game);
+    std::vector<uint16_t> codes;
+    const auto& history = game.history();
+    for (const auto& move : history) {
+        const auto& text = move.lan_.empty() ? move.san_ : move.lan_;
+        auto parsed = gameState.stringToMove(text, false);
+        if (parsed.isEmpty()) {
+            break;
+        }
+        auto code = BinaryMoveCodec::encode(parsed.getLAN());
+        if (!code) {
+            break;
+        }
+        codes.push_back(*code);
+        gameState.doMove(parsed);
+    }
+    const bool complete = codes.size() == history.size();
+    if (!complete) {
+        ++truncatedGames_;
+    }
+
+    putVarint(encoded, codes.size());
+    for (uint16_t code : codes) {
+        putFixed(encoded, code, 2);
+    }
+
+    uint8_t flags = 0;
+    for (size_t i = 0; i < codes.size(); ++i) {
+        const auto& move = history[i];
+        if (move.timeMs != 0) {
+            flags |= FLAG_CLOCKS;
+        }
+        if (move.scoreCp.has_value() || move.scoreMate.has_value() || move.depth != 0) {
+            flags |= FLAG_EVALS;
+        }
+    }
+    encoded.push_back(static_cast<char>(flags));
+    if ((flags & FLAG_CLOCKS) != 0) {
+        for (size_t i = 0; i < codes.size(); ++i) {
+            putVarint(encoded, static_cast<uint64_t>(history[i].timeMs));
+        }
+    }
+    if ((flags & FLAG_EVALS) != 0) {
+        for (size_t i = 0; i < codes.size(); ++i) {
+            const auto& move = history[i];
+            if (move.scoreMate.has_value()) {
+                encoded.push_back(static_cast<char>(EvalKind::Mate));
+                putZigzag(encoded, *move.scoreMate);
+            } else if (move.scoreCp.has_value()) {
+                encoded.push_back(static_cast<char>(EvalKind::Centipawns));
+                putZigzag(encoded, *move.scoreCp);
+            } else {
+                encoded.push_back(static_cast<char>(EvalKind::None));
+            }
+            putVarint(encoded, static_cast<uint64_t>(std::max<int64_t>(0, static_cast<int64_t>(move.depth))));
+        }
+    }
+
+    putVarint(block_, encoded.size());
+    block_ += encoded;
+    ++blockGames_;
+    ++gameCount_;
+    if (blockGames_ >= GAMES_PER_BLOCK) {
+        flushBlock();
+    }
+    return complete;
+}
+
+void BinaryGameWriter::flushBlock() {
+    if (blockGames_ == 0) {
+        return;
+    }
+    std::string blockHeader;
+    putFixed(blockHeader, blockGames_, 4);
+    putFixed(blockHeader, block_.size(), 4);
+    blocks_.push_back({ .offset = static_cast<uint64_t>(out_.tellp()), .gameCount = blockGames_ });
+    out_.write(blockHeader.data(), static_cast<std::streamsize>(blockHeader.size()));
+    out_.write(block_.data(), static_cast<std::streamsize>(block_.size()));
+    block_.clear();
+    blockGames_ = 0;
+}
+
+void BinaryGameWriter::finish() {
+    if (finished_) {
+        return;
+    }
+    finished_ = true;
+    flushBlock();
+
+    std::string trailer;
+    putVarint(trailer, dictionary_.size());
+    for (const auto& text : dictionary_) {
+        putVarint(trailer, text.size());
+        trailer += text;
+    }
+    putVarint(trailer, blocks_.size());
+    for (const auto& block : blocks_) {
+        putFixed(trailer, block.offset, 8);
+        putFixed(trailer, block.gameCount, 4);
+    }
+    auto trailerOffset = static_cast<uint64_t>(out_.tellp());
+    putFixed(trailer, trailerOffset, 8);
+    trailer += FOOTER_MAGIC;
+    out_.write(trailer.data(), static_cast<std::streamsize>(trailer.size()));
+    out_.close();
+    if (out_.fail()) {
+        throw std::runtime_error(std::format("Failed to write file: {}", fileName_));
+    }
+    if (truncatedGames_ > 0) {
+        Logger::reportLogger().log(std::format("{} of {} games written to {} contain an illegal move, "
+            "the moves from the illegal move on are not stored", truncatedGames_, gameCount_, fileName_),
+            TraceLevel::warning);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reader
+// ------------------------------------------------------------------------------------------------
+
+bool BinaryGameReader::isBinaryGameFile(const std::string& fileName) {
+    auto extension = std::filesystem::path(fileName).extension().string();
+    std::ranges::transform(extension, extension.begin(), 
+        [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    return extension == STORE_EXTENSION;
+}
+
+/**
+ * @brief Decoding result of one block.
+ */
+struct DecodedBlock {
+    std::vector<GameRecord> games;
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> sizes;
+};
+
+static void decodeBlock(const std::string& fileName, uint64_t blockOffset,
+    const std::vector<std::string>& dictionary, DecodedBlock& decoded) {
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error(std::format("Failed to open file for reading: {}", fileName));
+    }
+    std::string blockHeader = readFileRange(in, blockOffset, 8);
+    ByteReader headerReader(blockHeader);
+    auto gameCount = headerReader.fixed(4);
+    auto payloadSize = headerReader.fixed(4);
+    const uint64_t payloadOffset = blockOffset + 8;
+    std::string payload = readFileRange(in, payloadOffset, payloadSize);
+
+    if (gameCount > payloadSize / MIN_GAME_SIZE) {
+        throw std::runtime_error(std::format("Corrupt game store: block game count too large in {}", fileName));
+    }
+
+    ByteReader reader(payload);
+    decoded.games.reserve(gameCount);
+    for (uint64_t i = 0; i < gameCount; ++i) {
+        auto size = reader.varint();
+        auto offset = reader.position();
+        decoded.games.push_back(decodeGame(reader.bytes(size), dictionary, false));
+        decoded.offsets.push_back(payloadOffset + offset);
+        decoded.sizes.push_back(static_cast<uint32_t>(size));
+    }
+}
+
+std::vector<GameRecord> BinaryGameReader::load(const std::string& fileName,
+    std::function<bool(const GameRecord&, float)> gameCallback) {
+    fileName_ = fileName;
+    dictionary_.clear();
+    locations_.clear();
+
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error(std::format("Failed to open file for reading: {}", fileName));
+    }
+    auto fileSize = std::filesystem::file_size(fileName);
+    if (fileSize < HEADER_SIZE + FOOTER_SIZE || readFileRange(in, 0, 4) != FILE_MAGIC) {
+        throw std::runtime_error(std::format("Not a binary game store: {}", fileName));
+    }
+    std::string footer = readFileRange(in, fileSize - FOOTER_SIZE, FOOTER_SIZE);
+    ByteReader footerReader(footer);
+    auto trailerOffset = footerReader.fixed(8);
+    if (footerReader.bytes(4) != FOOTER_MAGIC || trailerOffset < HEADER_SIZE 
+        || trailerOffset > fileSize - FOOTER_SIZE) {
+        throw std::runtime_error(std::format("Corrupt or incomplete game store: {}", fileName));
+    }
+
+    std::string trailer = readFileRange(in, trailerOffset, fileSize - FOOTER_SIZE - trailerOffset);
+    ByteReader trailerReader(trailer);
+    auto dictionarySize = trailerReader.varint();
+    for (uint64_t i = 0; i < dictionarySize; ++i) {
+        auto length = trailerReader.varint();
+        dictionary_.emplace_back(trailerReader.bytes(length));
+    }
+    std::vector<uint64_t> blockOffsets;
+    uint64_t totalGames = 0;
+    auto blockCount = trailerReader.varint();
+    for (uint64_t i = 0; i < blockCount; ++i) {
+        blockOffsets.push_back(trailerReader.fixed(8));
+        totalGames += trailerReader.fixed(4);
+    }
+    // The counts are read from the file, check them before reserving memory for them
+    if (totalGames > (trailerOffset - HEADER_SIZE) / MIN_GAME_SIZE) {
+        throw std::runtime_error(std::format("Corrupt game store: game count too large in {}", fileName));
+    }
+
+    // Blocks are decoded in parallel waves; callbacks run in file order on this thread
+    std::vector<GameRecord> games;
+    games.reserve(totalGames);
+    locations_.reserve(totalGames);
+    const size_t waveSize = std::max(1U, std::thread::hardware_concurrency());
+    for (size_t waveStart = 0; waveStart < blockOffsets.size(); waveStart += waveSize) {
+        const size_t waveEnd = std::min(waveStart + waveSize, blockOffsets.size());
+        std::vector<DecodedBlock> decoded(waveEnd - waveStart);
+        std::vector<std::exception_ptr> errors(decoded.size());
+        std::vector<std::thread> workers;
+        for (size_t block = waveStart; block < waveEnd; ++block) {
+            workers.emplace_back([&, block]() {
+                try {
+                    decodeBlock(fileName, blockOffsets[block], dictionary_, decoded[block - waveStart]);
+                } catch (...) {
+                    errors[block - waveStart] = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        for (auto& block : decoded) {
+            for (size_t i = 0; i < block.games.size(); ++i) {
+                games.push_back(std::move(block.games[i]));
+                locations_.push_back({ .offset = block.offsets[i], .size = block.sizes[i] });
+                float progress = static_cast<float>(games.size()) / static_cast<float>(totalGames);
+                if (gameCallback && !gameCallback(games.back(), progress)) {
+                    return games;
+                }
+            }
+        }
+    }
+    return games;
+}
+
+std::optional<GameRecord> BinaryGameReader::loadGameAtIndex(size_t index) const {
+    if (index >= locations_.size()) {
+        return std::nullopt;
+    }
+    try {
+        std::ifstream in(fileName_, std::ios::binary);
+        const auto& location = locations_[index];
+        std::string data = readFileRange(in, location.offset, location.size);
+        return decodeGame(data, dictionary_, true);
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+size_t BinaryGameReader::convertPgn(const std::string& pgnFile, const std::string& binaryFile,
+    std::function<void(size_t, float)> progressCallback,
+    std::function<bool()> cancelCheck) {
+    BinaryGameWriter writer(binaryFile);
+    PgnIO pgnIO;
+    // Loads with comments, so clock and evaluation side streams are filled
+    pgnIO.loadGames(pgnFile, false, [&](const GameRecord& game, float progress) {
+        writer.addGame(game);
+        if (progressCallback) {
+            progressCallback(writer.gameCount(), progress);
+        }
+        return !cancelCheck || !cancelCheck();
+    });
+    writer.finish();
+    return writer.gameCount();
+}
+
+} // namespace QaplaWindows
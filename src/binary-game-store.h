@@ -0,0 +1,185 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <chess-game/game-record.h>
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Encodes moves in 16 bits: from square (6 bits), to square (6 bits) and 
+ * promotion piece (3 bits). Squares are numbered a1 = 0 to h8 = 63.
+ */
+namespace BinaryMoveCodec {
+
+    /**
+     * @brief Encodes a move in long algebraic notation (e.g. "e2e4", "e7e8q").
+     * @param lan Move in long algebraic notation.
+     * @return The 16 bit code, or std::nullopt if the string is no valid LAN move.
+     */
+    std::optional<uint16_t> encode(std::string_view lan);
+
+    /**
+     * @brief Decodes a 16 bit move code to long algebraic notation.
+     * @param code The move code.
+     * @return The move in long algebraic notation.
+     */
+    std::string decode(uint16_t code);
+
+} // namespace BinaryMoveCodec
+
+/**
+ * @brief Writes games to a compact binary game store file (.qgb).
+ * 
+ * Layout: a header, blocks of games, a trailer with the string dictionary (tag names, 
+ * tag values and start positions) and the block index, and a fixed size footer pointing
+ * to the trailer. Every game stores its tags as dictionary ids, its moves as 16 bit codes
+ * and optional clock and evaluation side streams.
+ */
+class BinaryGameWriter {
+public:
+    /**
+     * @brief Creates or truncates the target file and writes the header.
+     * @param fileName Target file.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    explicit BinaryGameWriter(const std::string& fileName);
+    ~BinaryGameWriter();
+
+    BinaryGameWriter(const BinaryGameWriter&) = delete;
+    BinaryGameWriter& operator=(const BinaryGameWriter&) = delete;
+
+    /**
+     * @brief Appends a game. The moves are replayed to obtain their long algebraic notation;
+     * the game is stored up to its first illegal move and counted as truncated.
+     * @param game The game to append.
+     * @return false, if the game was truncated.
+     */
+    bool addGame(const QaplaTester::GameRecord& game);
+
+    /**
+     * @brief Writes the pending block, the trailer and the footer and closes the file.
+     * Reports the number of truncated games to the report logger.
+     * @throws std::runtime_error on write errors.
+     */
+    void finish();
+
+    /**
+     * @brief Gets the number of games written so far.
+     */
+    [[nodiscard]] size_t gameCount() const { return gameCount_; }
+
+    /**
+     * @brief Gets the number of games stored without the moves following an illegal move.
+     */
+    [[nodiscard]] size_t truncatedGameCount() const { return truncatedGames_; }
+
+private:
+    struct BlockInfo {
+        uint64_t offset;
+        uint32_t gameCount;
+    };
+
+    uint32_t stringId(const std::string& text);
+    void flushBlock();
+
+    std::string fileName_;
+    std::ofstream out_;
+    std::unordered_map<std::string, uint32_t> dictionaryIds_;
+    std::vector<std::string> dictionary_;
+    std::vector<BlockInfo> blocks_;
+    std::string block_;
+    uint32_t blockGames_ = 0;
+    size_t gameCount_ = 0;
+    size_t truncatedGames_ = 0;
+    bool finished_ = false;
+};
+
+/**
+ * @brief Reads binary game store files (.qgb).
+ * 
+ * load() decodes the blocks in parallel. The returned games carry tags, result and moves 
+ * in long algebraic notation only, which is all the game list needs. loadGameAtIndex() 
+ * decodes a single game completely including SAN notation, clocks and evaluations.
+ */
+class BinaryGameReader {
+public:
+    /**
+     * @brief Checks whether a file name has the binary game store extension.
+     * @param fileName File name to check.
+     */
+    [[nodiscard]] static bool isBinaryGameFile(const std::string& fileName);
+
+    /**
+     * @brief Loads all games of a binary game store.
+     * @param fileName Name of the file to load.
+     * @param gameCallback Optional callback called for each loaded game with the progress (0-1).
+     *        Returning false stops loading.
+     * @return The loaded games.
+     * @throws std::runtime_error if the file cannot be read or is corrupt.
+     */
+    std::vector<QaplaTester::GameRecord> load(const std::string& fileName, 
+        std::function<bool(const QaplaTester::GameRecord&, float)> gameCallback = nullptr);
+
+    /**
+     * @brief Loads and completely decodes a game of the last loaded file.
+     * @param index Index of the game.
+     * @return The game record, or std::nullopt if the index is out of range or unreadable.
+     */
+    [[nodiscard]] std::optional<QaplaTester::GameRecord> loadGameAtIndex(size_t index) const;
+
+    /**
+     * @brief Gets the name of the last loaded file.
+     */
+    [[nodiscard]] const std::string& getCurrentFileName() const { return fileName_; }
+
+    /**
+     * @brief Converts a PGN file to a binary game store, including clock and evaluation comments.
+     * @param pgnFile Source PGN file.
+     * @param binaryFile Target binary game store file.
+     * @param progressCallback Callback for progress updates (games converted, progress 0-1).
+     * @param cancelCheck Function to check if operation should be cancelled.
+     * @return Number of games converted.
+     */
+    static size_t convertPgn(const std::string& pgnFile, const std::string& binaryFile,
+        std::function<void(size_t, float)> progressCallback = nullptr,
+        std::function<bool()> cancelCheck = nullptr);
+
+private:
+    struct GameLocation {
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    std::string fileName_;
+    std::vector<std::string> dictionary_;
+    std::vector<GameLocation> locations_;
+};
+
+} // namespace QaplaWindows
@@ -19,6 +19,7 @@
 
 #include "callback-manager.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace QaplaWindows::Callback {
@@ -55,7 +56,157 @@ void UnregisterHandle::unregister() {
     }
 }
 
+// PollScheduler implementation
+std::unique_ptr<UnregisterHandle> PollScheduler::registerCallback(Callback callback) {
+    return registerCallback(Options{}, std::move(callback));
+}
+
+std::unique_ptr<UnregisterHandle> PollScheduler::registerCallback(Options options, Callback callback) {
+    if (!callback) {
+        return nullptr;
+    }
+    CallbackId id = nextId_.fetch_add(1);
+    {
+        std::scoped_lock lock(callbacks_mutex_);
+        Entry entry;
+        entry.statistics.name = options.name;
+        entry.statistics.priority = options.priority;
+        entry.options = std::move(options);
+        entry.callback = std::make_shared<Callback>(std::move(callback));
+        callbacks_.emplace(id, std::move(entry));
+    }
+    return std::make_unique<UnregisterHandle>(this, id);
+}
+
+bool PollScheduler::unregister(CallbackId id) {
+    std::scoped_lock lock(callbacks_mutex_);
+    return callbacks_.erase(id) > 0;
+}
+
+PollScheduler::Clock::duration PollScheduler::interval(Priority priority) {
+    switch (priority) {
+    case Priority::Frame:
+        return Clock::duration::zero();
+    case Priority::Background:
+        return BACKGROUND_INTERVAL;
+    case Priority::Idle:
+        return IDLE_INTERVAL;
+    }
+    return Clock::duration::zero();
+}
+
+void PollScheduler::invokeAll(Clock::time_point now) {
+    struct Due {
+        CallbackId id;
+        std::shared_ptr<Callback> callback;
+        Clock::time_point lastRun;
+        bool mandatory;                      ///< Runs regardless of the budget
+        bool onTime;                         ///< The interval of the callback elapsed
+        std::function<bool()> isVisible;
+    };
+    std::vector<Due> due;
+
+    frame_++;
+    {
+        std::scoped_lock lock(callbacks_mutex_);
+        due.reserve(callbacks_.size());
+        for (auto& [id, entry] : callbacks_) {
+            auto wait = interval(entry.options.priority);
+            auto waited = now - entry.lastRun;
+            bool mandatory = wait == Clock::duration::zero() || waited >= wait * MAX_DEFERRED_INTERVALS;
+            bool onTime = waited >= wait;
+            if (!mandatory && !onTime && !entry.options.isVisible) {
+                continue;
+            }
+            due.push_back({ id, entry.callback, entry.lastRun, mandatory, onTime,
+                mandatory ? nullptr : entry.options.isVisible });
+        }
+    }
+
+    // Visibility is checked without the lock, the check may access other windows
+    for (auto& item : due) {
+        if (!item.mandatory && item.isVisible) {
+            item.mandatory = item.isVisible();
+        }
+    }
+    std::erase_if(due, [](const Due& item) { return !item.mandatory && !item.onTime; });
+
+    // Mandatory callbacks first, then the longest waiting ones
+    std::ranges::stable_sort(due, [](const Due& a, const Due& b) {
+        if (a.mandatory != b.mandatory) {
+            return a.mandatory;
+        }
+        return a.lastRun < b.lastRun;
+    });
 
+    const auto frameStart = Clock::now();
+    for (const auto& item : due) {
+        const auto start = Clock::now();
+        if (!item.mandatory && start - frameStart >= frameBudget_) {
+            std::scoped_lock lock(callbacks_mutex_);
+            auto it = callbacks_.find(item.id);
+            if (it != callbacks_.end()) {
+                it->second.statistics.deferred++;
+            }
+            continue;
+        }
+        try {
+            (*item.callback)();
+        }
+        catch (...) {
+            // Catch any exceptions to ensure all callbacks are called
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+        std::scoped_lock lock(callbacks_mutex_);
+        auto it = callbacks_.find(item.id);
+        if (it == callbacks_.end()) {
+            continue;
+        }
+        auto& entry = it->second;
+        entry.lastRun = now;
+        auto& stats = entry.statistics;
+        stats.calls++;
+        stats.total += elapsed;
+        stats.last = elapsed;
+        stats.max = std::max(stats.max, elapsed);
+    }
+}
+
+std::vector<PollScheduler::Statistics> PollScheduler::statistics() const {
+    std::scoped_lock lock(callbacks_mutex_);
+    std::vector<Statistics> result;
+    result.reserve(callbacks_.size());
+    for (const auto& [id, entry] : callbacks_) {
+        result.push_back(entry.statistics);
+    }
+    std::ranges::sort(result, [](const Statistics& a, const Statistics& b) {
+        return a.total > b.total;
+    });
+    return result;
+}
+
+void PollScheduler::resetStatistics() {
+    std::scoped_lock lock(callbacks_mutex_);
+    for (auto& [id, entry] : callbacks_) {
+        entry.statistics = Statistics{ .name = entry.options.name, .priority = entry.options.priority };
+    }
+}
+
+size_t PollScheduler::size() const {
+    std::scoped_lock lock(callbacks_mutex_);
+    return callbacks_.size();
+}
+
+bool PollScheduler::empty() const {
+    std::scoped_lock lock(callbacks_mutex_);
+    return callbacks_.empty();
+}
+
+void PollScheduler::clear() {
+    std::scoped_lock lock(callbacks_mutex_);
+    callbacks_.clear();
+}
 
 } // namespace QaplaWindows::Callback
 
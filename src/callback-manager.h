@@ -27,6 +27,9 @@
 #include <mutex>
 #include <iostream>
 #include <type_traits>
+#include <chrono>
+#include <cstdint>
+#include <string>
 
 #include <chess-game/game-record.h>
 
@@ -297,12 +300,132 @@ public:
 template <typename... Args>
 using Manager = ManagerBase<void, Args...>;
 
+/**
+ * @brief Manager for the per-frame poll callbacks.
+ * 
+ * Frame callbacks and callbacks of visible windows run every frame. Background and idle 
+ * callbacks run at a lower rate and share a per-frame time budget: the longest waiting 
+ * callbacks run first and the remaining ones are deferred to the next frames, so 
+ * expensive refreshes are spread over several frames. A callback deferred for too long 
+ * runs regardless of the budget. The run time of every callback is recorded.
+ */
+class PollScheduler : public Unregisterable {
+public:
+    using Callback = std::function<void()>;
+    using Clock = std::chrono::steady_clock;
+
+    enum class Priority {
+        Frame,        ///< Runs every frame
+        Background,   ///< Runs every BACKGROUND_INTERVAL unless visible
+        Idle          ///< Runs every IDLE_INTERVAL unless visible
+    };
+
+    struct Options {
+        std::string name;                     ///< Name shown in the statistics
+        Priority priority = Priority::Frame;
+        std::function<bool()> isVisible;      ///< If set and true, the callback runs every frame
+    };
+
+    struct Statistics {
+        std::string name;
+        Priority priority = Priority::Frame;
+        uint64_t calls = 0;
+        uint64_t deferred = 0;                ///< Frames the callback was due but over budget
+        std::chrono::microseconds total{0};
+        std::chrono::microseconds max{0};
+        std::chrono::microseconds last{0};
+    };
+
+    static constexpr auto BACKGROUND_INTERVAL = std::chrono::milliseconds(100);
+    static constexpr auto IDLE_INTERVAL = std::chrono::milliseconds(1000);
+    static constexpr auto DEFAULT_FRAME_BUDGET = std::chrono::microseconds(4000);
+    /// A callback waiting this many intervals runs regardless of the budget
+    static constexpr int MAX_DEFERRED_INTERVALS = 5;
+
+    PollScheduler() = default;
+    ~PollScheduler() override = default;
+
+    /**
+     * @brief Registers a callback running every frame.
+     * @param callback The function to call.
+     * @return Handle unregistering the callback on destruction.
+     */
+    std::unique_ptr<UnregisterHandle> registerCallback(Callback callback);
+
+    /**
+     * @brief Registers a callback with a priority and an optional visibility check.
+     * @param options Name, priority and visibility of the callback.
+     * @param callback The function to call.
+     * @return Handle unregistering the callback on destruction.
+     */
+    std::unique_ptr<UnregisterHandle> registerCallback(Options options, Callback callback);
+
+    bool unregister(CallbackId id) override;
+
+    /**
+     * @brief Runs the callbacks due in this frame.
+     */
+    void invokeAll() {
+        invokeAll(Clock::now());
+    }
+
+    /**
+     * @brief Runs the callbacks due at the given time.
+     * @param now Time deciding which callbacks are due.
+     */
+    void invokeAll(Clock::time_point now);
+
+    /**
+     * @brief Sets the time budget for background and idle callbacks per frame.
+     */
+    void setFrameBudget(std::chrono::microseconds budget) {
+        frameBudget_ = budget;
+    }
+
+    /**
+     * @brief Gets the number of frames run so far.
+     */
+    [[nodiscard]] uint64_t frame() const {
+        return frame_.load();
+    }
+
+    /**
+     * @brief Gets the timing counters of all registered callbacks.
+     */
+    [[nodiscard]] std::vector<Statistics> statistics() const;
+
+    /**
+     * @brief Resets the timing counters.
+     */
+    void resetStatistics();
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool empty() const;
+    void clear();
+
+private:
+    struct Entry {
+        Options options;
+        std::shared_ptr<Callback> callback;
+        Clock::time_point lastRun;
+        Statistics statistics;
+    };
+
+    [[nodiscard]] static Clock::duration interval(Priority priority);
+
+    std::unordered_map<CallbackId, Entry> callbacks_;
+    std::atomic<CallbackId> nextId_{1};
+    std::atomic<uint64_t> frame_{0};
+    std::chrono::microseconds frameBudget_ = DEFAULT_FRAME_BUDGET;
+    mutable std::mutex callbacks_mutex_;
+};
+
 } // namespace Callback
 
 class StaticCallbacks {
 public:
-    static Callback::Manager<>& poll() {
-        static Callback::Manager<> instance;
+    static Callback::PollScheduler& poll() {
+        static Callback::PollScheduler instance;
         return instance;
     }    
 
@@ -328,4 +451,33 @@ public:
   
 };
 
+/**
+ * @brief Tracks whether a window has been drawn recently, to let its data source poll 
+ * every frame only while it is visible.
+ */
+class Visibility {
+public:
+    explicit Visibility(const Callback::PollScheduler& scheduler = StaticCallbacks::poll())
+        : scheduler_(&scheduler) {}
+
+    /**
+     * @brief Marks the window as drawn in the current frame.
+     */
+    void markDrawn() {
+        drawnFrame_ = scheduler_->frame();
+    }
+
+    /**
+     * @brief Checks if the window was drawn in the current or the previous frame.
+     */
+    [[nodiscard]] bool isVisible() const {
+        auto drawn = drawnFrame_.load();
+        return drawn != 0 && scheduler_->frame() <= drawn + 1;
+    }
+
+private:
+    const Callback::PollScheduler* scheduler_;
+    std::atomic<uint64_t> drawnFrame_{0};
+};
+
 } // namespace QaplaWindows
@@ -23,6 +23,7 @@
 #include "os-dialogs.h"
 #include "configuration.h"
 #include "snackbar.h"
+#include "engine-fingerprint-cache.h"
 
 #include <engine-handling/engine-worker-factory.h>
 
@@ -181,20 +182,14 @@ void ChatbotStepLoadEngine::addEngines() {
 }
 
 void ChatbotStepLoadEngine::startDetection() {
-    try {
-        QaplaConfiguration::Configuration::instance().getEngineCapabilities().autoDetect();
-        detectionStarted_ = true;
-    } catch (const std::exception& ex) {
-        SnackbarManager::instance().showWarning(
-            std::format("Engine auto-detect failed,\nsome engines may not be detected\n {}", ex.what()));
-    }
-    QaplaConfiguration::Configuration::instance().setModified();
+    EngineFingerprintCache::instance().detect();
+    detectionStarted_ = true;
 }
 
 void ChatbotStepLoadEngine::drawDetecting() {
     QaplaWindows::ImGuiControls::textWrapped("We are now checking the engines and reading their options (auto-detect)...");
     
-    bool detecting = QaplaConfiguration::Configuration::instance().getEngineCapabilities().isDetecting();
+    bool detecting = EngineFingerprintCache::instance().isDetecting();
     
     if (detecting) {
         // Indeterminate progress bar
@@ -25,7 +25,8 @@
 namespace QaplaWindows::ChatBot {
 
 bool ChatbotStepEpdContinueExisting::hasIncompleteAnalysis() const {
-    const auto& epdData = EpdData::instance();
+    auto& epdData = EpdData::instance();
+    epdData.ensureLoaded();
     // Analysis can be continued if:
     // - State is Stopped (not running, not cleared)
     // - There are total tests (analysis was started at some point)
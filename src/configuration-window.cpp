@@ -24,6 +24,13 @@
 #include "configuration.h"
 #include "tutorial.h"
 #include "os-dialogs.h"
+#include "resource-budget.h"
+#include "cpu-affinity.h"
+#include "engine-spare-pool.h"
+#include "tournament-data.h"
+#include "distributed-tournament.h"
+#include "perf-hud.h"
+#include "memory-accounting.h"
 #include "i18n.h"
 
 #include <base-elements/logger.h>
@@ -143,6 +150,46 @@ void ConfigurationWindow::draw()
     }
     
     ImGui::Spacing();
+
+    if (ImGuiControls::CollapsingHeaderWithDot("Memory", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Indent(10.0F);
+        drawMemoryConfig();
+        ImGui::Unindent(10.0F);
+    }
+    
+    ImGui::Spacing();
+
+    if (ImGuiControls::CollapsingHeaderWithDot("Resource Budget", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Indent(10.0F);
+        drawResourceBudgetConfig();
+        ImGui::Unindent(10.0F);
+    }
+    
+    ImGui::Spacing();
+
+    if (ImGuiControls::CollapsingHeaderWithDot("CPU Pinning", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Indent(10.0F);
+        drawCpuAffinityConfig();
+        ImGui::Unindent(10.0F);
+    }
+    
+    ImGui::Spacing();
+
+    if (ImGuiControls::CollapsingHeaderWithDot("Engine Spares", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Indent(10.0F);
+        drawEngineSpareConfig();
+        ImGui::Unindent(10.0F);
+    }
+    
+    ImGui::Spacing();
+
+    if (ImGuiControls::CollapsingHeaderWithDot("Experimental")) {
+        ImGui::Indent(10.0F);
+        drawExperimentalConfig();
+        ImGui::Unindent(10.0F);
+    }
+    
+    ImGui::Spacing();
 }
 
 void ConfigurationWindow::drawSnackbarConfig()
@@ -241,6 +288,136 @@ void ConfigurationWindow::drawPerformanceConfig()
         "- Removes decorative background image\n"
         "Requires restart to apply changes."
     );
+
+    auto& perfHud = PerfHud::instance();
+    bool showOverlay = perfHud.isEnabled();
+    if (ImGuiControls::checkbox("Performance overlay", showOverlay)) {
+        perfHud.setEnabled(showOverlay);
+    }
+    ImGuiControls::hooverTooltip(
+        "Shows frame time, poll time per data source, draw time per tab,\n"
+        "GPU render time and vertex counts with histograms of the last ten seconds"
+    );
+}
+
+void ConfigurationWindow::drawMemoryConfig()
+{
+    constexpr float inputWidth = 200.0F;
+    constexpr uint32_t maxInterval = 24 * 60;
+    constexpr float sizeColumnWidth = 100.0F;
+    constexpr float countColumnWidth = 80.0F;
+
+    auto& accounting = MemoryAccounting::instance();
+    auto& config = accounting.getConfig();
+
+    ImGui::Spacing();
+    ImGui::SetNextItemWidth(inputWidth);
+    if (ImGuiControls::inputInt<uint32_t>("Log interval (minutes)", config.logIntervalMinutes, 0, maxInterval)) {
+        accounting.updateConfiguration();
+    }
+    ImGuiControls::hooverTooltip("Writes the memory usage per subsystem to the report log in this interval,\n"
+        "zero disables the log line");
+
+    auto usage = accounting.usage();
+    int64_t total = 0;
+    for (const auto& entry : usage) {
+        total += entry.bytes;
+    }
+    ImGui::Spacing();
+    ImGui::Text("%s: %s", tr("Memory", "Estimated total").c_str(), MemoryAccounting::formatBytes(total).c_str());
+    ImGuiControls::hooverTooltip("Estimated from sizes and capacities of the largest data structures.\n"
+        "Allocator overhead and memory of engines and fonts are not included.");
+
+    constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_BordersInnerV;
+    if (ImGui::BeginTable("MemoryBreakdown", 3, tableFlags)) {
+        ImGui::TableSetupColumn(tr("Memory", "Subsystem").c_str(), ImGuiTableColumnFlags_WidthFixed, 2 * inputWidth);
+        ImGui::TableSetupColumn(tr("Memory", "Instances").c_str(), ImGuiTableColumnFlags_WidthFixed, countColumnWidth);
+        ImGui::TableSetupColumn(tr("Memory", "Size").c_str(), ImGuiTableColumnFlags_WidthFixed, sizeColumnWidth);
+        ImGui::TableHeadersRow();
+        for (const auto& entry : usage) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(entry.subsystem.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%lld", static_cast<long long>(entry.instances));
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(MemoryAccounting::formatBytes(entry.bytes).c_str());
+        }
+        ImGui::EndTable();
+    }
+}
+
+void ConfigurationWindow::drawResourceBudgetConfig()
+{
+    constexpr float inputWidth = 200.0F;
+    constexpr uint32_t maxCores = 4096;
+    constexpr uint32_t maxMemoryMB = 16U * 1024U * 1024U;
+    bool modified = false;
+
+    auto& budget = ResourceBudget::instance();
+    auto& config = budget.getConfig();
+
+    ImGui::Spacing();
+    modified |= ImGuiControls::checkbox("Limit concurrency by resources", config.enabled);
+    ImGuiControls::hooverTooltip("Limits parallel games by the Threads and Hash options of the engines");
+
+    ImGui::SetNextItemWidth(inputWidth);
+    modified |= ImGuiControls::inputInt<uint32_t>("Cores", config.coreBudget, 0, maxCores);
+    ImGuiControls::hooverTooltip("Number of cores used by engines, zero selects all cores");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(%u)", budget.coreBudget());
+
+    ImGui::SetNextItemWidth(inputWidth);
+    modified |= ImGuiControls::inputInt<uint32_t>("Memory (MB)", config.memoryBudgetMB, 0, maxMemoryMB, 256, 1024);
+    ImGuiControls::hooverTooltip("Memory in MB for engine hash tables, zero selects most of the memory");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(%u MB)", budget.memoryBudgetMB());
+
+    if (modified) {
+        budget.updateConfiguration();
+    }
+}
+
+void ConfigurationWindow::drawCpuAffinityConfig()
+{
+    auto& affinity = CpuAffinityManager::instance();
+    auto& config = affinity.getConfig();
+    bool modified = false;
+
+    ImGui::Spacing();
+    if (!CpuAffinityManager::isSupported()) {
+        ImGui::TextDisabled("CPU pinning is only available on Linux");
+        return;
+    }
+    modified |= ImGuiControls::checkbox("Pin engines to CPU sets", config.enabled);
+    ImGuiControls::hooverTooltip("Binds the engines of each parallel game to their own cores.\n"
+        "The running games table of the tournament shows the CPUs of each game.");
+    modified |= ImGuiControls::checkbox("Use SMT siblings", config.useSmtSiblings);
+    ImGuiControls::hooverTooltip("Adds the hyperthreads of the cores to the CPU sets");
+
+    if (modified) {
+        affinity.updateConfiguration();
+    }
+}
+
+void ConfigurationWindow::drawEngineSpareConfig()
+{
+    constexpr float inputWidth = 200.0F;
+    constexpr uint32_t maxSpares = 8;
+
+    auto& sparePool = EngineSparePool::instance();
+    auto& config = sparePool.getConfig();
+
+    ImGui::Spacing();
+    ImGui::SetNextItemWidth(inputWidth);
+    if (ImGuiControls::inputInt<uint32_t>("Spares per engine", config.sparesPerEngine, 0, maxSpares)) {
+        sparePool.updateConfiguration();
+    }
+    ImGuiControls::hooverTooltip("Keeps started engines in reserve, so switching or restarting engines on a board is instant.\n"
+        "Each spare is a running engine process, zero disables the spares. Spares serve\n"
+        "interactive boards only, tournaments and SPRT tests start their own engines.");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(%zu running)", sparePool.spareCount());
 }
 
 void ConfigurationWindow::drawLoggerConfig()
@@ -298,3 +475,19 @@ void ConfigurationWindow::drawLoggerConfig()
         QaplaConfiguration::Configuration::updateLoggerConfiguration();
     }
 }
+
+void ConfigurationWindow::drawExperimentalConfig()
+{
+    ImGui::Spacing();
+    if (!DistributedTournament::isSupported()) {
+        ImGui::TextDisabled("Worker processes are not supported on this platform");
+        return;
+    }
+    auto& tournamentData = TournamentData::instance();
+    bool enabled = tournamentData.isWorkerModeEnabled();
+    if (ImGuiControls::checkbox("Tournament worker processes", enabled)) {
+        tournamentData.setWorkerModeEnabled(enabled);
+    }
+    ImGuiControls::hooverTooltip("Shows the worker process setting in the tournament tab.\n"
+        "The running games and the adjudication tests of the workers are not shown.");
+}
@@ -93,6 +93,31 @@ namespace QaplaWindows
          */
         static void drawPerformanceConfig();
 
+        /**
+         * @brief Draws the section showing the memory usage per subsystem
+         */
+        static void drawMemoryConfig();
+
+        /**
+         * @brief Draws the resource budget section limiting concurrent engine games
+         */
+        static void drawResourceBudgetConfig();
+
+        /**
+         * @brief Draws the CPU pinning section
+         */
+        static void drawCpuAffinityConfig();
+
+        /**
+         * @brief Draws the section configuring warm engine spares
+         */
+        static void drawEngineSpareConfig();
+
+        /**
+         * @brief Draws the section enabling experimental features
+         */
+        static void drawExperimentalConfig();
+
         BufferedTextInput reportBaseNameInput_;  ///< Buffered input for report log base name
         BufferedTextInput engineBaseNameInput_;  ///< Buffered input for engine log base name
     };
@@ -0,0 +1,481 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "cpu-affinity.h"
+#include "configuration.h"
+
+#include <game-manager/engine-record.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <format>
+#include <sstream>
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace QaplaWindows {
+
+namespace {
+
+    constexpr auto POLL_INTERVAL = std::chrono::milliseconds(500);
+    constexpr auto PENDING_TIMEOUT = std::chrono::seconds(10);  ///< Engines not started by then stay unpinned
+
+    std::optional<int> readIntFile(const std::filesystem::path& path) {
+        std::ifstream in(path);
+        int value = 0;
+        if (in >> value) {
+            return value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Parses a kernel CPU list like "0-3,8,10-11".
+     */
+    std::vector<int> parseCpuList(const std::string& text) {
+        std::vector<int> cpus;
+        std::stringstream stream(text);
+        std::string range;
+        while (std::getline(stream, range, ',')) {
+            try {
+                auto dash = range.find('-');
+                int first = std::stoi(range.substr(0, dash));
+                int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            } catch (const std::exception&) {
+                // Ignores malformed entries
+            }
+        }
+        return cpus;
+    }
+
+    std::vector<int> listNumericDirectories(const std::filesystem::path& path) {
+        std::vector<int> result;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(path, error)) {
+            const auto name = entry.path().filename().string();
+            if (!name.empty() && std::ranges::all_of(name, [](unsigned char ch) { return std::isdigit(ch) != 0; })) {
+                result.push_back(std::stoi(name));
+            }
+        }
+        return result;
+    }
+
+#ifdef __linux__
+    /**
+     * @brief Lists the direct child processes of the GUI with their command names.
+     */
+    std::map<int, std::string> listChildProcesses() {
+        std::map<int, std::string> children;
+        const int self = static_cast<int>(getpid());
+        for (int pid : listNumericDirectories("/proc")) {
+            std::ifstream in(std::format("/proc/{}/stat", pid));
+            std::string stat;
+            if (!std::getline(in, stat)) {
+                continue;
+            }
+            // Format: pid (comm) state ppid ...; comm may contain spaces and parentheses
+            auto open = stat.find('(');
+            auto close = stat.rfind(')');
+            if (open == std::string::npos || close == std::string::npos || close < open) {
+                continue;
+            }
+            std::istringstream rest(stat.substr(close + 1));
+            std::string state;
+            int parent = 0;
+            if (rest >> state >> parent && parent == self && state != "Z") {
+                children[pid] = stat.substr(open + 1, close - open - 1);
+            }
+        }
+        return children;
+    }
+
+    /**
+     * @brief Gets the file name of the executable a process runs.
+     */
+    std::string processExecutable(int pid) {
+        std::error_code error;
+        auto exe = std::filesystem::read_symlink(std::format("/proc/{}/exe", pid), error);
+        return error ? std::string{} : exe.filename().string();
+    }
+#endif
+
+    /**
+     * @brief Gets the file names a process started with the engine command may run: the 
+     * command itself and the target of a symbolic link.
+     */
+    std::set<std::string> engineExecutables(const std::string& cmd) {
+        std::set<std::string> names;
+        std::filesystem::path path(cmd);
+        names.insert(path.filename().string());
+        std::error_code error;
+        auto resolved = std::filesystem::canonical(path, error);
+        if (!error) {
+            names.insert(resolved.filename().string());
+        }
+        return names;
+    }
+
+} // namespace
+
+CpuAffinityManager::CpuAffinityManager()
+{
+    topology_ = detectTopology();
+    rebuildPartition();
+    pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+        Callback::PollScheduler::Options{ .name = "CPU pinning", .priority = Callback::PollScheduler::Priority::Background },
+        [this]() {
+            this->poll();
+        }
+    );
+}
+
+void CpuAffinityManager::loadConfiguration() {
+    auto sections = QaplaConfiguration::Configuration::instance().
+        getConfigData().getSectionList("cpuaffinity", "general").value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+
+    if (!sections.empty()) {
+        const auto& section = sections[0];
+        config_.enabled = section.getValue("enabled").value_or("false") == "true";
+        config_.useSmtSiblings = section.getValue("usesmtsiblings").value_or("false") == "true";
+    }
+    rebuildPartition();
+}
+
+void CpuAffinityManager::updateConfiguration() {
+    QaplaHelpers::IniFile::Section section {
+        .name = "cpuaffinity",
+        .entries = QaplaHelpers::IniFile::KeyValueMap{
+            {"id", "general"},
+            {"enabled", config_.enabled ? "true" : "false"},
+            {"usesmtsiblings", config_.useSmtSiblings ? "true" : "false"}
+        }
+    };
+    QaplaConfiguration::Configuration::instance().getConfigData().setSectionList("cpuaffinity", "general", { section });
+    rebuildPartition();
+}
+
+bool CpuAffinityManager::isSupported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<CpuAffinityManager::CpuInfo> CpuAffinityManager::detectTopology() {
+    std::vector<CpuInfo> cpus;
+#ifdef __linux__
+    const std::filesystem::path cpuRoot = "/sys/devices/system/cpu";
+    std::ifstream onlineFile(cpuRoot / "online");
+    std::string online;
+    std::getline(onlineFile, online);
+
+    std::map<int, int> cpuToNode;
+    const std::filesystem::path nodeRoot = "/sys/devices/system/node";
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(nodeRoot, error)) {
+        const auto name = entry.path().filename().string();
+        if (!name.starts_with("node")) {
+            continue;
+        }
+        std::ifstream listFile(entry.path() / "cpulist");
+        std::string list;
+        std::getline(listFile, list);
+        for (int cpu : parseCpuList(list)) {
+            cpuToNode[cpu] = std::atoi(name.c_str() + 4);
+        }
+    }
+
+    for (int cpu : parseCpuList(online)) {
+        auto topology = cpuRoot / std::format("cpu{}", cpu) / "topology";
+        CpuInfo info{ .cpu = cpu };
+        info.core = readIntFile(topology / "core_id").value_or(cpu);
+        info.package = readIntFile(topology / "physical_package_id").value_or(0);
+        auto node = cpuToNode.find(cpu);
+        info.node = node != cpuToNode.end() ? node->second : info.package;
+        cpus.push_back(info);
+    }
+#endif
+    return cpus;
+}
+
+std::vector<std::vector<int>> CpuAffinityManager::partition(const std::vector<CpuInfo>& cpus,
+    uint32_t slotCount, bool useSmtSiblings) {
+    slotCount = std::max(1U, slotCount);
+
+    // Collects the cores per node; every core lists its logical CPUs, first CPU first
+    std::map<int, std::map<std::pair<int, int>, std::vector<int>>> nodes;
+    for (const auto& info : cpus) {
+        nodes[info.node][{ info.package, info.core }].push_back(info.cpu);
+    }
+    std::vector<std::vector<std::vector<int>>> nodeCores;
+    size_t totalCores = 0;
+    for (auto& [node, cores] : nodes) {
+        std::vector<std::vector<int>> coreList;
+        for (auto& [key, threads] : cores) {
+            std::ranges::sort(threads);
+            if (!useSmtSiblings) {
+                threads.resize(1);
+            }
+            coreList.push_back(threads);
+        }
+        std::ranges::sort(coreList, {}, [](const auto& threads) { return threads.front(); });
+        totalCores += coreList.size();
+        nodeCores.push_back(std::move(coreList));
+    }
+    if (totalCores == 0) {
+        return std::vector<std::vector<int>>(slotCount);
+    }
+
+    // Distributes the slots to the nodes in proportion to their size (largest remainder)
+    std::vector<uint32_t> nodeSlots(nodeCores.size());
+    std::vector<std::pair<size_t, size_t>> remainders;
+    uint32_t assigned = 0;
+    for (size_t node = 0; node < nodeCores.size(); ++node) {
+        size_t share = slotCount * nodeCores[node].size();
+        nodeSlots[node] = static_cast<uint32_t>(share / totalCores);
+        assigned += nodeSlots[node];
+        remainders.emplace_back(share % totalCores, node);
+    }
+    std::ranges::sort(remainders, [](const auto& left, const auto& right) {
+        return left.first != right.first ? left.first > right.first : left.second < right.second;
+    });
+    for (size_t i = 0; assigned < slotCount; ++i, ++assigned) {
+        nodeSlots[remainders[i % remainders.size()].second]++;
+    }
+
+    // Splits the cores of each node into contiguous ranges
+    std::vector<std::vector<int>> result;
+    for (size_t node = 0; node < nodeCores.size(); ++node) {
+        const auto& cores = nodeCores[node];
+        const uint32_t slots = nodeSlots[node];
+        for (uint32_t slot = 0; slot < slots; ++slot) {
+            std::vector<int> set;
+            // Games sharing a core would compete for it, thus such slots stay unpinned
+            if (slots <= cores.size()) {
+                size_t begin = slot * cores.size() / slots;
+                size_t end = (slot + 1) * cores.size() / slots;
+                for (size_t core = begin; core < end; ++core) {
+                    set.insert(set.end(), cores[core].begin(), cores[core].end());
+                }
+            }
+            std::ranges::sort(set);
+            result.push_back(std::move(set));
+        }
+    }
+    return result;
+}
+
+std::string CpuAffinityManager::formatCpuList(const std::vector<int>& cpus) {
+    std::string result;
+    for (size_t i = 0; i < cpus.size(); ) {
+        size_t end = i;
+        while (end + 1 < cpus.size() && cpus[end + 1] == cpus[end] + 1) {
+            ++end;
+        }
+        if (!result.empty()) {
+            result += ',';
+        }
+        result += end == i ? std::to_string(cpus[i]) : std::format("{}-{}", cpus[i], cpus[end]);
+        i = end + 1;
+    }
+    return result;
+}
+
+void CpuAffinityManager::setSlotCount(uint32_t slotCount) {
+    slotCount = std::max(1U, slotCount);
+    if (slotCount == slotCount_) {
+        return;
+    }
+    slotCount_ = slotCount;
+    rebuildPartition();
+}
+
+void CpuAffinityManager::rebuildPartition() {
+    slotCpus_ = partition(topology_, slotCount_, config_.useSmtSiblings);
+    for (auto& [pid, state] : processes_) {
+        bindProcess(pid, state, true);
+    }
+}
+
+void CpuAffinityManager::bindProcess([[maybe_unused]] int pid, [[maybe_unused]] ProcessState& state, 
+    [[maybe_unused]] bool force) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    // A slot beyond the partition, e.g. a game finishing after the concurrency was lowered, 
+    // has no CPU set of its own and is not pinned
+    if (config_.enabled && state.slot < slotCpus_.size() && !slotCpus_[state.slot].empty()) {
+        for (int cpu : slotCpus_[state.slot]) {
+            CPU_SET(cpu, &set);
+        }
+    } else {
+        // Releases the process to all CPUs
+        for (const auto& info : topology_) {
+            CPU_SET(info.cpu, &set);
+        }
+    }
+    if (force) {
+        state.boundThreads.clear();
+    }
+    // Threads started before binding keep their affinity, so every thread is bound
+    for (int tid : listNumericDirectories(std::format("/proc/{}/task", pid))) {
+        if (state.boundThreads.insert(tid).second) {
+            sched_setaffinity(tid, sizeof(set), &set);
+        }
+    }
+#endif
+}
+
+void CpuAffinityManager::excludeProcess(int pid) {
+    excluded_.insert(pid);
+    auto it = processes_.find(pid);
+    if (it != processes_.end()) {
+        bindProcess(pid, it->second, true);
+        processes_.erase(it);
+    }
+}
+
+void CpuAffinityManager::collectPoolEngines(std::chrono::steady_clock::time_point now) {
+    std::map<uint32_t, std::set<std::string>> current;
+    poolAccess_->withEngineRecords(
+        [&](const QaplaTester::EngineRecords& records, uint32_t slot) {
+            auto& known = slotEngines_[slot];
+            for (const auto& record : records) {
+                current[slot].insert(record.identifier);
+                if (!known.contains(record.identifier)) {
+                    pending_.push_back(PendingEngine{
+                        .slot = slot,
+                        .name = record.config.getName(),
+                        .executables = engineExecutables(record.config.getCmd()),
+                        .listed = now
+                    });
+                }
+            }
+        },
+        []([[maybe_unused]] uint32_t slot) -> bool {
+            return true;
+        });
+    slotEngines_ = std::move(current);
+}
+
+void CpuAffinityManager::matchPendingEngines([[maybe_unused]] const std::map<int, std::string>& children) {
+#ifdef __linux__
+    // The library reports no process ids, thus engines are matched to unbound children by their
+    // executable. Engines with the same executables are only bound together, when exactly as many
+    // unbound children run it. Then no other process is among them, and every slot gets as many 
+    // processes as it lists engines. Otherwise the engines wait for the next poll.
+    std::vector<std::pair<int, std::string>> unbound;
+    for (const auto& [pid, name] : children) {
+        if (processes_.contains(pid) || excluded_.contains(pid)) {
+            continue;
+        }
+        auto executable = processExecutable(pid);
+        if (!executable.empty()) {
+            unbound.emplace_back(pid, executable);
+        }
+    }
+    std::ranges::stable_sort(pending_, {}, &PendingEngine::slot);
+    std::map<std::set<std::string>, std::vector<size_t>> groups;
+    for (size_t index = 0; index < pending_.size(); ++index) {
+        groups[pending_[index].executables].push_back(index);
+    }
+    std::set<size_t> matched;
+    for (const auto& [executables, engines] : groups) {
+        std::vector<int> candidates;
+        for (const auto& [pid, executable] : unbound) {
+            if (executables.contains(executable)) {
+                candidates.push_back(pid);
+            }
+        }
+        if (candidates.size() != engines.size()) {
+            continue;
+        }
+        for (size_t index = 0; index < engines.size(); ++index) {
+            const auto& engine = pending_[engines[index]];
+            auto& state = processes_[candidates[index]];
+            state.name = engine.name;
+            state.slot = engine.slot;
+            bindProcess(candidates[index], state, true);
+            matched.insert(engines[index]);
+        }
+    }
+    for (auto index = pending_.size(); index > 0; --index) {
+        if (matched.contains(index - 1)) {
+            pending_.erase(pending_.begin() + static_cast<std::ptrdiff_t>(index - 1));
+        }
+    }
+#endif
+}
+
+void CpuAffinityManager::poll() {
+    if (!isSupported() || (!config_.enabled && processes_.empty())) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastPoll_ < POLL_INTERVAL) {
+        return;
+    }
+    lastPoll_ = now;
+
+#ifdef __linux__
+    auto children = listChildProcesses();
+    std::erase_if(processes_, [&](const auto& entry) { 
+        return !children.contains(entry.first); 
+    });
+    std::erase_if(excluded_, [&](int pid) { return !children.contains(pid); });
+
+    if (!config_.enabled) {
+        processes_.clear();
+        pending_.clear();
+        slotEngines_.clear();
+        return;
+    }
+
+    collectPoolEngines(now);
+    matchPendingEngines(children);
+    std::erase_if(pending_, [&](const PendingEngine& engine) { 
+        return now - engine.listed > PENDING_TIMEOUT; 
+    });
+
+    for (auto& [pid, state] : processes_) {
+        // Binds threads started since the last poll
+        bindProcess(pid, state, false);
+    }
+#endif
+}
+
+std::string CpuAffinityManager::getSlotCpus(uint32_t slot) const {
+    if (!config_.enabled || slot >= slotCpus_.size()) {
+        return {};
+    }
+    bool pinned = std::ranges::any_of(processes_, [&](const auto& entry) { return entry.second.slot == slot; });
+    return pinned ? formatCpuList(slotCpus_[slot]) : std::string{};
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,179 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "callback-manager.h"
+#include "game-manager-pool-access.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Pins engine processes to disjoint CPU sets, one set per concurrency slot.
+ * 
+ * The online CPUs are partitioned into as many sets as games run in parallel. Sets never 
+ * span NUMA nodes if the slots fit into the nodes, and SMT siblings of a core stay in the 
+ * same set or are left out. Engines are started by the tester library, which neither reports
+ * process ids nor sets an affinity at process creation. On polling, engines newly listed in a
+ * slot of the game manager pool are matched to unbound child processes of the GUI running the 
+ * same executable, and the process is bound with sched_setaffinity to the CPU set of that pool
+ * slot. Engines are only bound if the match is unambiguous, and slots beyond the partition are
+ * not pinned. Children without a pool engine, like worker processes or engines of interactive
+ * boards, are never pinned. Pinning is only supported on Linux.
+ */
+class CpuAffinityManager {
+public:
+    /**
+     * @brief Topology information of a logical CPU.
+     */
+    struct CpuInfo {
+        int cpu = 0;       ///< Logical CPU number
+        int core = 0;      ///< Core id within the package
+        int package = 0;   ///< Physical package (socket) id
+        int node = 0;      ///< NUMA node
+    };
+
+    /**
+     * @brief User settings of the pinning.
+     */
+    struct Config {
+        bool enabled = false;        ///< Pins engine processes if true
+        bool useSmtSiblings = false; ///< Adds the SMT siblings of the cores to the CPU sets
+    };
+
+    static CpuAffinityManager& instance() {
+        static CpuAffinityManager instance;
+        return instance;
+    }
+
+    Config& getConfig() { return config_; }
+    const Config& getConfig() const { return config_; }
+
+    /**
+     * @brief Loads the pinning settings from the configuration data.
+     */
+    void loadConfiguration();
+
+    /**
+     * @brief Stores the pinning settings and rebinds all engine processes.
+     */
+    void updateConfiguration();
+
+    /**
+     * @brief Checks whether pinning is supported on this platform.
+     */
+    [[nodiscard]] static bool isSupported();
+
+    /**
+     * @brief Reads the CPU topology of the machine.
+     * @return The online logical CPUs, empty if the topology is unavailable.
+     */
+    [[nodiscard]] static std::vector<CpuInfo> detectTopology();
+
+    /**
+     * @brief Partitions CPUs into disjoint sets.
+     * 
+     * Slots are distributed to NUMA nodes in proportion to the node sizes. Within a node 
+     * every slot gets a contiguous range of cores. If a node has more slots than cores, 
+     * its slots get empty sets and are not pinned.
+     * @param cpus The CPUs to partition.
+     * @param slotCount Number of sets.
+     * @param useSmtSiblings If false, only the first logical CPU of each core is used.
+     * @return One CPU set per slot.
+     */
+    [[nodiscard]] static std::vector<std::vector<int>> partition(const std::vector<CpuInfo>& cpus, 
+        uint32_t slotCount, bool useSmtSiblings);
+
+    /**
+     * @brief Formats a CPU set as a range list, e.g. "0-3,8".
+     */
+    [[nodiscard]] static std::string formatCpuList(const std::vector<int>& cpus);
+
+    /**
+     * @brief Sets the number of concurrency slots and rebinds the engine processes if it changed.
+     * @param slotCount Number of games running in parallel.
+     */
+    void setSlotCount(uint32_t slotCount);
+
+    /**
+     * @brief Binds new engine processes. Called regularly by the poll callback.
+     */
+    void poll();
+
+    /**
+     * @brief Excludes a child process from pinning, e.g. a helper engine started with the 
+     * same executable as a tournament engine.
+     * @param pid Process id of the child.
+     */
+    void excludeProcess(int pid);
+
+    /**
+     * @brief Gets the CPU set of a pool slot as range list, e.g. for the running games table.
+     * @param slot Pool slot of the game.
+     * @return The CPU list, empty if no engine process of the slot is pinned.
+     */
+    [[nodiscard]] std::string getSlotCpus(uint32_t slot) const;
+
+private:
+    CpuAffinityManager();
+
+    struct ProcessState {
+        std::string name;
+        uint32_t slot = 0;   ///< Pool slot running the engine
+        std::set<int> boundThreads;
+    };
+
+    /**
+     * @brief Engine newly listed in a pool slot, waiting for its process.
+     */
+    struct PendingEngine {
+        uint32_t slot = 0;
+        std::string name;
+        std::set<std::string> executables;  ///< File names the process may run
+        std::chrono::steady_clock::time_point listed;
+    };
+
+    void rebuildPartition();
+    void bindProcess(int pid, ProcessState& state, bool force);
+    void collectPoolEngines(std::chrono::steady_clock::time_point now);
+    void matchPendingEngines(const std::map<int, std::string>& children);
+
+    Config config_;
+    uint32_t slotCount_ = 1;
+    std::vector<CpuInfo> topology_;
+    std::vector<std::vector<int>> slotCpus_;
+    std::map<int, ProcessState> processes_;
+    std::map<uint32_t, std::set<std::string>> slotEngines_;  ///< Engine identifiers per pool slot
+    std::vector<PendingEngine> pending_;
+    std::set<int> excluded_;
+    GameManagerPoolAccess poolAccess_;
+    std::chrono::steady_clock::time_point lastPoll_;
+    std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
+};
+
+} // namespace QaplaWindows
@@ -0,0 +1,359 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "distributed-tournament.h"
+#include "tournament-slicer.h"
+#include "os-helpers.h"
+
+#include <base-elements/string-helper.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <csignal>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char **environ;
+#endif
+
+using QaplaHelpers::IniFile;
+
+namespace QaplaWindows {
+
+namespace {
+    constexpr auto STOP_TIMEOUT = std::chrono::seconds(3);
+
+    std::string uniqueSocketAddress() {
+        static std::atomic<uint32_t> counter{0};
+#ifdef _WIN32
+        return {};
+#else
+        auto path = std::filesystem::temp_directory_path() 
+            / std::format("qapla-{}-{}.sock", ::getpid(), counter++);
+        return "unix:" + path.string();
+#endif
+    }
+
+    std::string shardFile(size_t slot) {
+#ifdef _WIN32
+        return {};
+#else
+        return (std::filesystem::temp_directory_path() 
+            / std::format("qapla-{}-worker-{}.pgn", ::getpid(), slot)).string();
+#endif
+    }
+
+    std::string joinIndices(const std::vector<size_t>& indices) {
+        std::string result;
+        for (auto index : indices) {
+            if (!result.empty()) {
+                result += ',';
+            }
+            result += std::to_string(index);
+        }
+        return result;
+    }
+}
+
+DistributedTournament::~DistributedTournament() {
+    if (!isActive()) {
+        reapWorkers(false);
+        return;
+    }
+    stop(false);
+    auto deadline = std::chrono::steady_clock::now() + STOP_TIMEOUT;
+    while (isActive() && std::chrono::steady_clock::now() < deadline) {
+        reapWorkers(false);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+#ifndef _WIN32
+    for (auto& worker : workers_) {
+        if (worker.pid > 0) {
+            ::kill(worker.pid, SIGKILL);
+        }
+    }
+#endif
+    reapWorkers(true);
+}
+
+bool DistributedTournament::isSupported() {
+    return WorkerSocket::isSupported() && !QaplaHelpers::OsHelpers::getExecutablePath().empty();
+}
+
+void DistributedTournament::start(const Job& job) {
+    if (!isSupported()) {
+        throw std::runtime_error("Worker processes are not supported on this platform");
+    }
+    std::vector<bool> gauntlets;
+    for (const auto& engine : job.engines) {
+        gauntlets.push_back(engine.isGauntlet());
+    }
+    auto workerCount = std::max(1U, job.workers);
+    auto slices = TournamentSlicer::plan(job.engines.size(), gauntlets, job.gauntletMode, workerCount);
+    if (slices.empty()) {
+        throw std::runtime_error("No pairings to distribute to workers");
+    }
+    auto assignment = TournamentSlicer::assign(slices, workerCount);
+    std::erase_if(assignment, [](const auto& indices) { return indices.empty(); });
+    auto concurrency = std::max(1U, 
+        (job.concurrency + static_cast<uint32_t>(assignment.size()) - 1) / static_cast<uint32_t>(assignment.size()));
+
+    pgnFile_ = job.pgnFile;
+    startRounds_ = job.rounds;
+    roundsChanged_ = false;
+    listener_.listen(uniqueSocketAddress());
+
+    workers_.clear();
+    workers_.resize(assignment.size());
+    for (size_t slot = 0; slot < assignment.size(); ++slot) {
+        IniFile::SectionList sections = job.configSections;
+        for (const auto& engine : job.engines) {
+            sections.push_back(engine.toSection());
+        }
+        // Each worker picks the results of its slices
+        sections.insert(sections.end(), job.rounds.begin(), job.rounds.end());
+        sections.push_back(IniFile::Section{
+            .name = "worker",
+            .entries = QaplaHelpers::IniFile::KeyValueMap{
+                {"concurrency", std::to_string(concurrency)},
+                {"pgnfile", shardFile(slot)}
+            }
+        });
+        for (auto index : assignment[slot]) {
+            sections.push_back(IniFile::Section{
+                .name = "slice",
+                .entries = QaplaHelpers::IniFile::KeyValueMap{
+                    {"gauntlet", std::to_string(slices[index].gauntlet)},
+                    {"opponents", joinIndices(slices[index].opponents)}
+                }
+            });
+        }
+        std::ostringstream out;
+        IniFile::saveSections(out, sections);
+        workers_[slot].job = out.str();
+        spawnWorker(slot);
+    }
+}
+
+void DistributedTournament::spawnWorker([[maybe_unused]] size_t slot) {
+#ifndef _WIN32
+    auto executable = QaplaHelpers::OsHelpers::getExecutablePath();
+    std::vector<std::string> environment;
+    for (char** entry = environ; *entry != nullptr; ++entry) {
+        std::string_view value(*entry);
+        if (!value.starts_with("QAPLA_WORKER")) {
+            environment.emplace_back(value);
+        }
+    }
+    environment.push_back("QAPLA_WORKER=" + listener_.address());
+    environment.push_back("QAPLA_WORKER_SLOT=" + std::to_string(slot));
+
+    std::vector<char*> envp;
+    for (auto& entry : environment) {
+        envp.push_back(entry.data());
+    }
+    envp.push_back(nullptr);
+    std::vector<char*> argv{ executable.data(), nullptr };
+
+    pid_t pid = -1;
+    if (posix_spawn(&pid, executable.c_str(), nullptr, nullptr, argv.data(), envp.data()) != 0) {
+        throw std::runtime_error("Failed to start worker process " + executable);
+    }
+    workers_[slot].pid = pid;
+#endif
+}
+
+void DistributedTournament::acceptWorkers() {
+    while (auto socket = listener_.accept()) {
+        pending_.push_back(std::move(*socket));
+    }
+    for (auto it = pending_.begin(); it != pending_.end();) {
+        auto hello = it->receive(0);
+        if (!hello) {
+            it = it->isOpen() ? std::next(it) : pending_.erase(it);
+            continue;
+        }
+        auto slot = QaplaHelpers::to_uint32(hello->payload);
+        if (hello->type != WorkerMessageType::Hello || !slot || *slot >= workers_.size() 
+            || workers_[*slot].connected) {
+            it = pending_.erase(it);
+            continue;
+        }
+        auto& worker = workers_[*slot];
+        worker.socket = std::move(*it);
+        worker.connected = true;
+        worker.socket.send(WorkerMessage{ .type = WorkerMessageType::Job, .payload = worker.job });
+        it = pending_.erase(it);
+    }
+}
+
+void DistributedTournament::poll() {
+    if (workers_.empty()) {
+        return;
+    }
+    acceptWorkers();
+    // Reaped before reading, so that the last messages of an exited worker are still handled
+    reapWorkers(false);
+    for (auto& worker : workers_) {
+        try {
+            while (worker.socket.isOpen()) {
+                auto message = worker.socket.receive(0);
+                if (!message) {
+                    break;
+                }
+                handleMessage(worker, *message);
+            }
+        }
+        catch (const std::exception& e) {
+            error_ = std::string("Worker connection failed: ") + e.what();
+            worker.socket.close();
+        }
+    }
+}
+
+void DistributedTournament::handleMessage(Worker& worker, const WorkerMessage& message) {
+    switch (message.type) {
+    case WorkerMessageType::Games:
+        addGame(message.payload);
+        break;
+    case WorkerMessageType::Results:
+        addResults(worker, message.payload);
+        break;
+    case WorkerMessageType::Progress: {
+        std::istringstream in(message.payload);
+        uint32_t finished = 0;
+        in >> finished >> worker.runningGames;
+        break;
+    }
+    case WorkerMessageType::Done:
+        worker.runningGames = 0;
+        break;
+    case WorkerMessageType::Error:
+        error_ = message.payload;
+        break;
+    default:
+        break;
+    }
+}
+
+void DistributedTournament::addGame(const std::string& pgn) {
+    // One game per message, so games of different workers are never interleaved
+    if (!pgnFile_.empty()) {
+        std::ofstream out(pgnFile_, std::ios::binary | std::ios::app);
+        out << pgn;
+    }
+}
+
+void DistributedTournament::addResults(Worker& worker, const std::string& payload) {
+    std::istringstream in(payload);
+    auto sections = IniFile::load(in);
+    std::erase_if(sections, [](const IniFile::Section& section) { return section.name != "round"; });
+    worker.rounds = std::move(sections);
+    roundsChanged_ = true;
+}
+
+std::optional<IniFile::SectionList> DistributedTournament::takeRounds() {
+    if (!std::exchange(roundsChanged_, false)) {
+        return std::nullopt;
+    }
+    // Results of a worker replace the results its slices started with
+    std::map<std::string, IniFile::Section> rounds;
+    for (const auto& round : startRounds_) {
+        rounds.insert_or_assign(TournamentSlicer::roundKey(round), round);
+    }
+    for (const auto& worker : workers_) {
+        for (const auto& round : worker.rounds) {
+            rounds.insert_or_assign(TournamentSlicer::roundKey(round), round);
+        }
+    }
+    IniFile::SectionList result;
+    result.reserve(rounds.size());
+    for (auto& [key, round] : rounds) {
+        result.push_back(std::move(round));
+    }
+    return result;
+}
+
+void DistributedTournament::stop(bool graceful) {
+    for (auto& worker : workers_) {
+        if (worker.socket.isOpen()) {
+            worker.socket.send(WorkerMessage{ .type = WorkerMessageType::Stop, 
+                .payload = graceful ? "graceful" : "abort" });
+        }
+#ifndef _WIN32
+        else if (!graceful && worker.pid > 0 && !worker.connected) {
+            // The worker did not connect yet and would start the job
+            ::kill(worker.pid, SIGTERM);
+        }
+#endif
+    }
+}
+
+void DistributedTournament::reapWorkers([[maybe_unused]] bool wait) {
+#ifndef _WIN32
+    for (auto& worker : workers_) {
+        if (worker.pid <= 0) {
+            continue;
+        }
+        int status = 0;
+        if (::waitpid(worker.pid, &status, wait ? 0 : WNOHANG) == worker.pid) {
+            worker.pid = -1;
+            worker.runningGames = 0;
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                error_ = "A worker process terminated unexpectedly";
+            }
+        }
+    }
+#endif
+    if (!isActive()) {
+        for (size_t slot = 0; slot < workers_.size(); ++slot) {
+            std::error_code ignored;
+            std::filesystem::remove(shardFile(slot), ignored);
+        }
+        listener_.close();
+        pending_.clear();
+    }
+}
+
+bool DistributedTournament::isActive() const {
+    return std::ranges::any_of(workers_, [](const Worker& worker) { return worker.pid > 0; });
+}
+
+uint32_t DistributedTournament::runningGames() const {
+    uint32_t result = 0;
+    for (const auto& worker : workers_) {
+        result += worker.runningGames;
+    }
+    return result;
+}
+
+std::optional<std::string> DistributedTournament::takeError() {
+    return std::exchange(error_, std::nullopt);
+}
+
+} // namespace QaplaWindows
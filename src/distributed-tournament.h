@@ -0,0 +1,132 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "worker-protocol.h"
+
+#include <base-elements/ini-file.h>
+#include <engine-handling/engine-config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Coordinates a tournament played by several worker processes.
+ * 
+ * The pairings are split into disjoint gauntlet slices (see TournamentSlicer) and distributed 
+ * to child processes of the own executable running in worker mode (see runTournamentWorker).
+ * A crashing engine therefore only takes down its worker and the game managers are not 
+ * bound to a single process. The coordinator appends the games streamed by the workers to the 
+ * tournament PGN file. The workers report their results as round sections, which the caller 
+ * loads into its tournament like a saved tournament.
+ */
+class DistributedTournament {
+public:
+    struct Job {
+        QaplaHelpers::IniFile::SectionList configSections;  ///< tournament, openings, pgnoutput, draw and resign
+        QaplaHelpers::IniFile::SectionList rounds;          ///< Results of games already played
+        std::vector<QaplaTester::EngineConfig> engines;
+        bool gauntletMode = false;
+        uint32_t workers = 2;
+        uint32_t concurrency = 1;  ///< Games played in parallel over all workers
+        std::string pgnFile;       ///< Tournament PGN file, games are appended
+    };
+
+    DistributedTournament() = default;
+    ~DistributedTournament();
+
+    DistributedTournament(const DistributedTournament&) = delete;
+    DistributedTournament& operator=(const DistributedTournament&) = delete;
+
+    /**
+     * @brief Checks if worker processes are supported on this platform.
+     */
+    [[nodiscard]] static bool isSupported();
+
+    /**
+     * @brief Plans the slices and starts the worker processes.
+     * @param job The tournament to play.
+     * @throws std::runtime_error if the workers cannot be started.
+     */
+    void start(const Job& job);
+
+    /**
+     * @brief Accepts workers, handles their messages and reaps finished processes.
+     * Must be called regularly from the main thread.
+     */
+    void poll();
+
+    /**
+     * @brief Stops all workers.
+     * @param graceful True to let the workers finish their running games.
+     */
+    void stop(bool graceful);
+
+    /**
+     * @brief Checks if any worker process is still alive.
+     */
+    [[nodiscard]] bool isActive() const;
+
+    [[nodiscard]] uint32_t runningGames() const;
+
+    /**
+     * @brief Gets the round sections of all games, if a worker reported new results since 
+     * the last call. Sections are in the engine order of the workers, see 
+     * TournamentSlicer::orientRounds.
+     */
+    std::optional<QaplaHelpers::IniFile::SectionList> takeRounds();
+
+    /**
+     * @brief Gets and clears the last error reported by a worker.
+     */
+    std::optional<std::string> takeError();
+
+private:
+    struct Worker {
+        int pid = -1;
+        std::string job;          ///< Job payload sent after the hello message
+        WorkerSocket socket;
+        bool connected = false;
+        uint32_t runningGames = 0;
+        QaplaHelpers::IniFile::SectionList rounds;  ///< Last results reported by the worker
+    };
+
+    void spawnWorker(size_t slot);
+    void acceptWorkers();
+    void handleMessage(Worker& worker, const WorkerMessage& message);
+    void addGame(const std::string& pgn);
+    void addResults(Worker& worker, const std::string& payload);
+    void reapWorkers(bool wait);
+
+    WorkerListener listener_;
+    std::vector<Worker> workers_;
+    std::vector<WorkerSocket> pending_;  ///< Connected workers before their hello message
+    QaplaHelpers::IniFile::SectionList startRounds_;  ///< Results before the start
+    bool roundsChanged_ = false;
+    std::string pgnFile_;
+    std::optional<std::string> error_;
+};
+
+} // namespace QaplaWindows
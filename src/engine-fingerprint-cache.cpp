@@ -0,0 +1,203 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "engine-fingerprint-cache.h"
+#include "configuration.h"
+#include "snackbar.h"
+
+#include <base-elements/ini-file.h>
+#include <engine-handling/engine-worker-factory.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <string>
+#include <utility>
+#include <vector>
+
+using QaplaTester::EngineWorkerFactory;
+
+namespace QaplaWindows {
+
+namespace {
+    /**
+     * Paths of all configured engines that have detected capabilities.
+     */
+    std::vector<std::string> detectedEnginePaths() {
+        const auto& capabilities = QaplaConfiguration::Configuration::instance().getEngineCapabilities();
+        std::vector<std::string> paths;
+        for (const auto& config : EngineWorkerFactory::getConfigManager().getAllConfigs()) {
+            if (capabilities.getCapability(config.getCmd(), config.getProtocol()) 
+                && std::ranges::find(paths, config.getCmd()) == paths.end()) {
+                paths.push_back(config.getCmd());
+            }
+        }
+        return paths;
+    }
+
+    template <typename T>
+    bool isReady(const std::future<T>& future) {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+}
+
+EngineFingerprintCache::EngineFingerprintCache() {
+    pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+        Callback::PollScheduler::Options{ .name = "Engine fingerprints", .priority = Callback::PollScheduler::Priority::Background },
+        [this]() {
+            this->poll();
+        }
+    );
+}
+
+void EngineFingerprintCache::loadConfiguration() {
+    auto sections = QaplaConfiguration::Configuration::instance().
+        getConfigData().getSectionList("enginefingerprint", "engines").value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+
+    fingerprints_.clear();
+    for (const auto& section : sections) {
+        auto path = section.getValue("path");
+        if (!path || path->empty()) {
+            continue;
+        }
+        try {
+            fingerprints_[*path] = EngineFingerprint{
+                .path = *path,
+                .size = std::stoull(section.getValue("size").value_or("0")),
+                .modified = std::stoll(section.getValue("modified").value_or("0")),
+                .hash = std::stoull(section.getValue("hash").value_or("0"), nullptr, 16)
+            };
+        } catch (const std::exception&) {
+            // An unreadable fingerprint is treated like a missing one
+        }
+    }
+}
+
+void EngineFingerprintCache::updateConfiguration() {
+    std::vector<QaplaHelpers::IniFile::Section> sections;
+    for (const auto& [path, fingerprint] : fingerprints_) {
+        sections.push_back(QaplaHelpers::IniFile::Section{
+            .name = "enginefingerprint",
+            .entries = QaplaHelpers::IniFile::KeyValueMap{
+                {"id", "engines"},
+                {"path", path},
+                {"size", std::to_string(fingerprint.size)},
+                {"modified", std::to_string(fingerprint.modified)},
+                {"hash", std::format("{:016x}", fingerprint.hash)}
+            }
+        });
+    }
+    QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
+        "enginefingerprint", "engines", sections);
+}
+
+void EngineFingerprintCache::refresh() {
+    startCheck();
+}
+
+void EngineFingerprintCache::detect() {
+    if (isDetecting()) {
+        return;
+    }
+    detectPending_ = true;
+    startCheck();
+}
+
+bool EngineFingerprintCache::isDetecting() const {
+    return detectPending_ || QaplaConfiguration::Configuration::instance().getEngineCapabilities().isDetecting();
+}
+
+void EngineFingerprintCache::startCheck() {
+    if (check_.valid()) {
+        recheck_ = true;
+        return;
+    }
+    std::vector<EngineFingerprint> known;
+    std::vector<std::string> unknown;
+    for (const auto& path : detectedEnginePaths()) {
+        auto it = fingerprints_.find(path);
+        if (it != fingerprints_.end()) {
+            known.push_back(it->second);
+        } else {
+            // Capabilities detected before fingerprints existed are trusted once
+            unknown.push_back(path);
+        }
+    }
+
+    // The executables are read on a background thread, the content hash of large files
+    // takes noticeable time
+    check_ = std::async(std::launch::async, [known = std::move(known), unknown = std::move(unknown)]() {
+        return EngineFingerprint::checkAll(known, unknown);
+    });
+}
+
+void EngineFingerprintCache::applyCheck(EngineFingerprintCheck result) {
+    auto& capabilities = QaplaConfiguration::Configuration::instance().getEngineCapabilities();
+    for (const auto& path : result.changed) {
+        fingerprints_.erase(path);
+        for (const auto& config : EngineWorkerFactory::getConfigManager().getAllConfigs()) {
+            if (config.getCmd() == path) {
+                capabilities.deleteCapability(config.getCmd(), config.getProtocol());
+            }
+        }
+    }
+    for (auto& fingerprint : result.fingerprints) {
+        auto path = fingerprint.path;
+        fingerprints_[path] = std::move(fingerprint);
+    }
+    updateConfiguration();
+}
+
+void EngineFingerprintCache::runAutoDetect() {
+    try {
+        QaplaConfiguration::Configuration::instance().getEngineCapabilities().autoDetect();
+    } catch (const std::exception& ex) {
+        SnackbarManager::instance().showWarning(
+            std::format("Engine auto-detect failed,\nsome engines may not be detected\n {}", ex.what()),
+            false, "engine");
+    }
+    QaplaConfiguration::Configuration::instance().setModified();
+}
+
+void EngineFingerprintCache::forget(const std::string& path) {
+    if (fingerprints_.erase(path) > 0) {
+        updateConfiguration();
+    }
+}
+
+void EngineFingerprintCache::poll() {
+    bool detecting = QaplaConfiguration::Configuration::instance().getEngineCapabilities().isDetecting();
+    if (wasDetecting_ && !detecting) {
+        // Stores the fingerprints of the engines detected by the auto-detect
+        startCheck();
+    }
+    wasDetecting_ = detecting;
+
+    if (check_.valid() && isReady(check_)) {
+        applyCheck(check_.get());
+        if (std::exchange(detectPending_, false)) {
+            runAutoDetect();
+        }
+        if (std::exchange(recheck_, false)) {
+            startCheck();
+        }
+    }
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,104 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "engine-fingerprint.h"
+#include "callback-manager.h"
+
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Ties the detected engine capabilities to the engine builds they were detected from
+ * and runs the engine auto-detect.
+ * 
+ * The capabilities are stored in the configuration and survive a restart. This cache stores
+ * the fingerprint of each detected executable next to them. Capabilities of rebuilt 
+ * executables are removed before an auto-detect, so only new and changed engines are 
+ * probed again. Unchanged engines are recognized by size and modification time, the content
+ * hash is only computed for new fingerprints and for files with a new modification time.
+ * 
+ * The executables are checked on a background thread. The auto-detect of the engine 
+ * capabilities is started when the check finished.
+ */
+class EngineFingerprintCache {
+public:
+    static EngineFingerprintCache& instance() {
+        static EngineFingerprintCache instance;
+        return instance;
+    }
+
+    /**
+     * @brief Loads the stored fingerprints from the configuration data.
+     */
+    void loadConfiguration();
+
+    /**
+     * @brief Starts checking the executables of all detected engines in the background and
+     * removes the capabilities of engines whose executable changed since their detection.
+     */
+    void refresh();
+
+    /**
+     * @brief Starts an auto-detect of all new and changed engines in the background.
+     */
+    void detect();
+
+    /**
+     * @brief Checks if a detection is running, either here or in the engine capabilities.
+     */
+    [[nodiscard]] bool isDetecting() const;
+
+    /**
+     * @brief Forgets the fingerprint of a removed engine.
+     * @param path Path to the engine executable.
+     */
+    void forget(const std::string& path);
+
+private:
+    EngineFingerprintCache();
+
+    void poll();
+
+    /**
+     * @brief Starts the background check unless one is running.
+     */
+    void startCheck();
+
+    /**
+     * @brief Removes the capabilities of rebuilt executables and stores the new fingerprints.
+     */
+    void applyCheck(EngineFingerprintCheck result);
+    void runAutoDetect();
+    void updateConfiguration();
+
+    std::unordered_map<std::string, EngineFingerprint> fingerprints_;
+    std::future<EngineFingerprintCheck> check_;
+    bool recheck_ = false;          ///< Check again once the running check finished
+    bool detectPending_ = false;    ///< Auto-detect once the running check finished
+    bool wasDetecting_ = false;
+    std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
+};
+
+} // namespace QaplaWindows
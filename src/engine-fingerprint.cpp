@@ -0,0 +1,139 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "engine-fingerprint.h"
+
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace QaplaWindows {
+
+namespace {
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    constexpr size_t READ_CHUNK_SIZE = 1024 * 1024;
+
+    struct FileStat {
+        uint64_t size;
+        int64_t modified;
+    };
+
+    std::optional<FileStat> statFile(const std::string& path) {
+        std::error_code error;
+        auto size = std::filesystem::file_size(path, error);
+        if (error) {
+            return std::nullopt;
+        }
+        auto modified = std::filesystem::last_write_time(path, error);
+        if (error) {
+            return std::nullopt;
+        }
+        return FileStat{ .size = size, .modified = static_cast<int64_t>(modified.time_since_epoch().count()) };
+    }
+
+    /**
+     * Runs the function for every element on its own thread. Reading the executables is
+     * mostly I/O bound, so the parallel reads hide the latency of slow disks.
+     */
+    template <typename T, typename Function>
+    auto forEachParallel(const std::vector<T>& elements, Function function) {
+        using Result = decltype(function(elements.front()));
+        std::vector<std::future<Result>> futures;
+        futures.reserve(elements.size());
+        for (const auto& element : elements) {
+            futures.push_back(std::async(std::launch::async, function, std::cref(element)));
+        }
+        std::vector<Result> results;
+        results.reserve(elements.size());
+        for (auto& future : futures) {
+            results.push_back(future.get());
+        }
+        return results;
+    }
+}
+
+std::optional<EngineFingerprint> EngineFingerprint::compute(const std::string& path) {
+    auto stat = statFile(path);
+    if (!stat) {
+        return std::nullopt;
+    }
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+    uint64_t hash = FNV_OFFSET_BASIS;
+    std::vector<char> buffer(READ_CHUNK_SIZE);
+    while (in) {
+        in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        auto count = static_cast<size_t>(in.gcount());
+        for (size_t i = 0; i < count; ++i) {
+            hash ^= static_cast<uint8_t>(buffer[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+    return EngineFingerprint{ .path = path, .size = stat->size, .modified = stat->modified, .hash = hash };
+}
+
+EngineFingerprint::Status EngineFingerprint::check(std::optional<EngineFingerprint>& current) const {
+    auto stat = statFile(path);
+    if (!stat || stat->size != size) {
+        return Status::Changed;
+    }
+    if (stat->modified == modified) {
+        return Status::Unchanged;
+    }
+    // A copied or reinstalled identical build must not trigger a new detection
+    current = compute(path);
+    if (!current || current->hash != hash) {
+        return Status::Changed;
+    }
+    return Status::Touched;
+}
+
+EngineFingerprintCheck EngineFingerprint::checkAll(
+    const std::vector<EngineFingerprint>& known, const std::vector<std::string>& unknown) {
+    
+    auto statuses = forEachParallel(known, [](const EngineFingerprint& fingerprint) {
+        std::optional<EngineFingerprint> current;
+        auto status = fingerprint.check(current);
+        return std::make_pair(status, std::move(current));
+    });
+
+    EngineFingerprintCheck result;
+    for (size_t index = 0; index < known.size(); ++index) {
+        auto& [status, current] = statuses[index];
+        if (status == Status::Changed) {
+            result.changed.push_back(known[index].path);
+        } else if (status == Status::Touched && current) {
+            result.fingerprints.push_back(std::move(*current));
+        }
+    }
+    for (auto& fingerprint : forEachParallel(unknown, [](const std::string& path) { return compute(path); })) {
+        if (fingerprint) {
+            result.fingerprints.push_back(std::move(*fingerprint));
+        }
+    }
+    return result;
+}
+
+} // namespace QaplaWindows
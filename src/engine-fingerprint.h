@@ -0,0 +1,83 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace QaplaWindows {
+
+struct EngineFingerprintCheck;
+
+/**
+ * @brief Identifies the build of an engine executable by path, size, modification time 
+ * and a hash of the file content.
+ */
+struct EngineFingerprint {
+    std::string path;
+    uint64_t size = 0;
+    int64_t modified = 0;  ///< Modification time in file clock ticks
+    uint64_t hash = 0;     ///< 64 bit FNV-1a hash of the content
+
+    enum class Status {
+        Unchanged,  ///< Size and modification time match
+        Touched,    ///< Modification time differs, the content is the same
+        Changed     ///< The content differs or the file is missing
+    };
+
+    bool operator==(const EngineFingerprint& other) const = default;
+
+    /**
+     * @brief Computes the fingerprint of a file, reading its complete content.
+     * @param path Path to the executable.
+     * @return The fingerprint, or std::nullopt if the file cannot be read.
+     */
+    [[nodiscard]] static std::optional<EngineFingerprint> compute(const std::string& path);
+
+    /**
+     * @brief Compares the fingerprint with the current file. The content is only hashed 
+     * if the size matches but the modification time differs.
+     * @param current Receives the fingerprint of the current file, if it has been computed.
+     * @return Status of the file.
+     */
+    [[nodiscard]] Status check(std::optional<EngineFingerprint>& current) const;
+
+    /**
+     * @brief Checks stored fingerprints against their executables and computes the 
+     * fingerprints of executables without one. The files are read in parallel.
+     * @param known Stored fingerprints.
+     * @param unknown Paths of executables without a stored fingerprint.
+     * @return The rebuilt executables and the fingerprints to store.
+     */
+    [[nodiscard]] static EngineFingerprintCheck checkAll(
+        const std::vector<EngineFingerprint>& known, const std::vector<std::string>& unknown);
+};
+
+/**
+ * @brief Result of checking the stored fingerprints of several executables.
+ */
+struct EngineFingerprintCheck {
+    std::vector<std::string> changed;               ///< Executables rebuilt since their fingerprint
+    std::vector<EngineFingerprint> fingerprints;    ///< New fingerprints and touched files
+};
+
+} // namespace QaplaWindows
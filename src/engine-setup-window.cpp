@@ -28,6 +28,7 @@
 #include "configuration.h"
 #include "snackbar.h"
 #include "tutorial.h"
+#include "engine-fingerprint-cache.h"
 
 #include <base-elements/string-helper.h>
 #include <engine-handling/engine-config.h>
@@ -111,7 +112,7 @@ void EngineSetupWindow::setMatchingActiveEngines(const std::vector<QaplaTester::
 QaplaButton::ButtonState EngineSetupWindow::getButtonState(const std::string& button) const {
     auto& configManager = QaplaTester::EngineWorkerFactory::getConfigManagerMutable();
     auto configs = configManager.getAllConfigs();
-    bool detecting = QaplaConfiguration::Configuration::instance().getEngineCapabilities().isDetecting();
+    bool detecting = EngineFingerprintCache::instance().isDetecting();
     
     if (button == "Add") {
         if (configs.empty()) {
@@ -213,6 +214,7 @@ void QaplaWindows::EngineSetupWindow::executeCommand(const std::string &button)
                 QaplaTester::EngineWorkerFactory::getConfigManagerMutable().removeConfig(config);
                 QaplaConfiguration::Configuration::instance().getEngineCapabilities().deleteCapability(
                     config.getCmd(), config.getProtocol());
+                EngineFingerprintCache::instance().forget(config.getCmd());
             }
         }
         
@@ -222,14 +224,8 @@ void QaplaWindows::EngineSetupWindow::executeCommand(const std::string &button)
     }
     else if (button == "Detect")
     {
-        try {
-            QaplaConfiguration::Configuration::instance().getEngineCapabilities().autoDetect();
-        } catch (const std::exception& ex) {
-            SnackbarManager::instance().showWarning(
-                std::format("Engine auto-detect failed,\nsome engines may not be detected\n {}", ex.what()),
-                false, "engine");
-        }
-        QaplaConfiguration::Configuration::instance().setModified();
+        // Only new and rebuilt engines are probed again
+        EngineFingerprintCache::instance().detect();
     }
 
 }
@@ -0,0 +1,180 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "engine-spare-pool.h"
+#include "configuration.h"
+
+#include <base-elements/string-helper.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+using QaplaTester::EngineConfig;
+using QaplaTester::EngineList;
+using QaplaTester::EngineWorkerFactory;
+
+namespace QaplaWindows {
+
+namespace {
+    // Delay between a handoff and starting new spares, so the spares do not compete with
+    // the engines just handed over
+    constexpr auto REPLENISH_DELAY = std::chrono::seconds(2);
+    constexpr uint32_t MAX_SPARES_PER_ENGINE = 8;
+}
+
+EngineSparePool::EngineSparePool() {
+    pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+        Callback::PollScheduler::Options{ .name = "Engine spares", .priority = Callback::PollScheduler::Priority::Background },
+        [this]() {
+            this->poll();
+        }
+    );
+}
+
+void EngineSparePool::loadConfiguration() {
+    auto sections = QaplaConfiguration::Configuration::instance().
+        getConfigData().getSectionList("enginespares", "general").value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+
+    if (!sections.empty()) {
+        const auto& section = sections[0];
+        config_.sparesPerEngine = std::min(MAX_SPARES_PER_ENGINE,
+            QaplaHelpers::to_uint32(section.getValue("sparesperengine").value_or("0")).value_or(0));
+    }
+}
+
+void EngineSparePool::updateConfiguration() {
+    config_.sparesPerEngine = std::min(MAX_SPARES_PER_ENGINE, config_.sparesPerEngine);
+    QaplaHelpers::IniFile::Section section {
+        .name = "enginespares",
+        .entries = QaplaHelpers::IniFile::KeyValueMap{
+            {"id", "general"},
+            {"sparesperengine", std::to_string(config_.sparesPerEngine)}
+        }
+    };
+    QaplaConfiguration::Configuration::instance().getConfigData().setSectionList("enginespares", "general", { section });
+    dropUnexpected();
+    replenishPending_ = true;
+    replenishAt_ = std::chrono::steady_clock::now();
+}
+
+void EngineSparePool::prepare(const std::string& owner, const std::vector<EngineConfig>& engines) {
+    if (engines.empty()) {
+        release(owner);
+        return;
+    }
+    expected_[owner] = engines;
+    dropUnexpected();
+    replenishPending_ = true;
+    replenishAt_ = std::chrono::steady_clock::now() + REPLENISH_DELAY;
+}
+
+void EngineSparePool::release(const std::string& owner) {
+    if (expected_.erase(owner) > 0) {
+        dropUnexpected();
+    }
+}
+
+EngineList EngineSparePool::take(const std::vector<EngineConfig>& engines) {
+    // Engines created together may be renamed to keep their names unique, thus spares are
+    // only used for lists of different engines that all have a spare
+    std::vector<size_t> spareIndices;
+    for (size_t index = 0; index < engines.size(); ++index) {
+        const auto previous = engines.begin() + static_cast<std::ptrdiff_t>(index);
+        auto spare = std::ranges::find_if(spares_, [&](const Spare& candidate) {
+            return candidate.config == engines[index];
+        });
+        if (std::find(engines.begin(), previous, engines[index]) != previous || spare == spares_.end()) {
+            return EngineWorkerFactory::createEngines(engines, true);
+        }
+        spareIndices.push_back(static_cast<size_t>(spare - spares_.begin()));
+    }
+
+    EngineList result;
+    for (auto spareIndex : spareIndices) {
+        result.push_back(std::move(spares_[spareIndex].engines.front()));
+        spares_[spareIndex].engines.clear();
+    }
+    std::erase_if(spares_, [](const Spare& spare) { return spare.engines.empty(); });
+    replenishPending_ = true;
+    replenishAt_ = std::chrono::steady_clock::now() + REPLENISH_DELAY;
+    return result;
+}
+
+void EngineSparePool::clear() {
+    spares_.clear();
+    expected_.clear();
+    replenishPending_ = false;
+}
+
+uint32_t EngineSparePool::targetCount(const EngineConfig& config) const {
+    uint32_t owners = 0;
+    for (const auto& [owner, engines] : expected_) {
+        if (std::ranges::find(engines, config) != engines.end()) {
+            ++owners;
+        }
+    }
+    return owners * config_.sparesPerEngine;
+}
+
+void EngineSparePool::dropUnexpected() {
+    // Removes spares exceeding the number needed by the owners expecting their engine
+    for (size_t index = spares_.size(); index > 0; --index) {
+        const auto& config = spares_[index - 1].config;
+        auto count = std::ranges::count_if(spares_, [&](const Spare& spare) { return spare.config == config; });
+        if (static_cast<uint32_t>(count) > targetCount(config)) {
+            spares_.erase(spares_.begin() + static_cast<std::ptrdiff_t>(index - 1));
+        }
+    }
+}
+
+void EngineSparePool::replenish() {
+    for (const auto& [owner, engines] : expected_) {
+        for (const auto& config : engines) {
+            auto count = static_cast<uint32_t>(
+                std::ranges::count_if(spares_, [&](const Spare& spare) { return spare.config == config; }));
+            for (auto target = targetCount(config); count < target; ++count) {
+                // Engines start asynchronously, the handshake runs while the games continue
+                auto created = EngineWorkerFactory::createEngines({ config }, true);
+                if (created.empty()) {
+                    break;
+                }
+                spares_.push_back(Spare{ .config = config, .engines = std::move(created) });
+            }
+        }
+    }
+}
+
+void EngineSparePool::poll() {
+    if (!replenishPending_ || std::chrono::steady_clock::now() < replenishAt_) {
+        return;
+    }
+    replenishPending_ = false;
+    if (config_.sparesPerEngine == 0) {
+        return;
+    }
+    try {
+        replenish();
+    }
+    catch (...) {
+        // A spare that fails to start is created again on request and reports its error there
+    }
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,131 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "callback-manager.h"
+
+#include <engine-handling/engine-config.h>
+#include <engine-handling/engine-worker-factory.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Keeps started and initialized engines in reserve to hide the engine startup latency.
+ * 
+ * Each owner, e.g. an interactive board, tells the pool which engines it expects next. Some 
+ * time after each handoff the pool starts the configured number of spares per expected engine 
+ * and owner, so the next request for the same engines is served by processes that have already 
+ * finished their uci/isready handshake. Only interactive boards are served. Tournament and 
+ * SPRT games are started by the engine tester library's pool, which creates its engines itself, 
+ * so spares are neither kept for them nor counted in their ResourceBudget.
+ */
+class EngineSparePool {
+public:
+    /**
+     * @brief User settings of the spare pool.
+     */
+    struct Config {
+        uint32_t sparesPerEngine = 0;  ///< Number of warm spares per expected engine, 0 disables the pool
+    };
+
+    static EngineSparePool& instance() {
+        static EngineSparePool instance;
+        return instance;
+    }
+
+    Config& getConfig() { return config_; }
+    const Config& getConfig() const { return config_; }
+
+    /**
+     * @brief Loads the spare settings from the configuration data.
+     */
+    void loadConfiguration();
+
+    /**
+     * @brief Stores the spare settings in the configuration data and adapts the spares.
+     */
+    void updateConfiguration();
+
+    /**
+     * @brief Sets the engines an owner expects to request next. Spares of engines no owner 
+     * expects are stopped.
+     * @param owner Unique name of the owner, e.g. "board1".
+     * @param engines Configurations of the expected engines.
+     */
+    void prepare(const std::string& owner, const std::vector<QaplaTester::EngineConfig>& engines);
+
+    /**
+     * @brief Removes the expectations of an owner and stops the spares no longer needed.
+     * @param owner Unique name of the owner.
+     */
+    void release(const std::string& owner);
+
+    /**
+     * @brief Creates the engines for the given configurations. Warm spares are handed over 
+     * if a spare is available for every requested engine, otherwise all engines are started.
+     * @param engines Configurations of the engines to create.
+     * @return The engines, in the order of the configurations.
+     */
+    QaplaTester::EngineList take(const std::vector<QaplaTester::EngineConfig>& engines);
+
+    /**
+     * @brief Gets the number of engines held in reserve.
+     */
+    [[nodiscard]] size_t spareCount() const { return spares_.size(); }
+
+    /**
+     * @brief Stops all spares. Must be called before the engine handling shuts down.
+     */
+    void clear();
+
+private:
+    EngineSparePool();
+
+    struct Spare {
+        QaplaTester::EngineConfig config;
+        QaplaTester::EngineList engines;   ///< Holds exactly one engine
+    };
+
+    void poll();
+    void dropUnexpected();
+    void replenish();
+
+    /**
+     * @brief Gets the number of spares to keep for an engine: the spares per engine for 
+     * every owner expecting it.
+     */
+    [[nodiscard]] uint32_t targetCount(const QaplaTester::EngineConfig& config) const;
+
+    Config config_;
+    std::map<std::string, std::vector<QaplaTester::EngineConfig>> expected_;  ///< Expected engines by owner
+    std::vector<Spare> spares_;
+    bool replenishPending_ = false;
+    std::chrono::steady_clock::time_point replenishAt_;
+    std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
+};
+
+} // namespace QaplaWindows
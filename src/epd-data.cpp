@@ -23,6 +23,8 @@
 #include "configuration.h"
 #include "snackbar.h"
 #include "imgui-concurrency.h"
+#include "resource-budget.h"
+#include "memory-accounting.h"
 
 #include <engine-handling/engine-worker-factory.h>
 #include <base-elements/string-helper.h>
@@ -60,6 +62,9 @@ namespace QaplaWindows {
     { 
         setGameManagerPool(std::make_shared<GameManagerPool>());
         table_.setClickable(true);
+        table_.setMemorySubsystem("EPD results");
+        memoryEstimatorHandle_ = MemoryAccounting::instance().registerEstimator("EPD results", 
+            [this]() { return estimateResultBytes(); });
         setCallbacks();
         init();
     }
@@ -68,13 +73,21 @@ namespace QaplaWindows {
 
     void EpdData::setCallbacks() {
         pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+            Callback::PollScheduler::Options{
+                .name = "EPD analysis",
+                .priority = Callback::PollScheduler::Priority::Background,
+                .isVisible = [this]() { return visibility_.isVisible() || viewerBoardWindows_.isVisible(); }
+            },
 		    [this]() {
     			this->pollData();
 		    }
     	);
         saveCallbackHandle_ = StaticCallbacks::save().registerCallback(
             [this]() {
-                this->saveFile();
+                // Results never loaded are unchanged on disk
+                if (loaded_) {
+                    this->saveFile();
+                }
             }
         );
         
@@ -93,8 +106,9 @@ namespace QaplaWindows {
             epdConfig_ = EpdConfig{
                 .filepath = section.getValue("filepath").value_or(""),
                 .engines = {},
-                .maxConcurrency = QaplaHelpers::to_uint32(section.getValue("maxconcurrency").value_or("")).value_or(32),
+                .maxConcurrency = QaplaHelpers::to_uint32(section.getValue("maxconcurrency").value_or("")).value_or(256),
                 .concurrency = QaplaHelpers::to_uint32(section.getValue("concurrency").value_or("")).value_or(1),
+                .autoConcurrency = section.getValue("autoconcurrency").value_or("false") == "true",
                 .maxTimeInS = QaplaHelpers::to_uint32(section.getValue("maxtime").value_or("")).value_or(10),
                 .minTimeInS = QaplaHelpers::to_uint32(section.getValue("mintime").value_or("")).value_or(1),
                 .seenPlies = QaplaHelpers::to_uint32(section.getValue("seenplies").value_or("")).value_or(3)
@@ -116,6 +130,7 @@ namespace QaplaWindows {
         
         // Initialize external concurrency from saved config
         setExternalConcurrency(epdConfig_.concurrency);
+        setAutoConcurrency(epdConfig_.autoConcurrency);
     }
 
     void EpdData::updateConfiguration() const {
@@ -126,6 +141,7 @@ namespace QaplaWindows {
                 {"filepath", epdConfig_.filepath},
                 {"maxconcurrency", std::to_string(epdConfig_.maxConcurrency)},
                 {"concurrency", std::to_string(imguiConcurrency_->getExternalConcurrency())},
+                {"autoconcurrency", imguiConcurrency_->isAutoMode() ? "true" : "false"},
                 {"maxtime", std::to_string(epdConfig_.maxTimeInS)},
                 {"mintime", std::to_string(epdConfig_.minTimeInS)},
                 {"seenplies", std::to_string(epdConfig_.seenPlies)}
@@ -138,10 +154,26 @@ namespace QaplaWindows {
         return imguiConcurrency_->getExternalConcurrency();
     }
 
+    uint32_t EpdData::getResourceLimit() const {
+        return imguiConcurrency_->getResourceLimit();
+    }
+
     void EpdData::setExternalConcurrency(uint32_t count) {
         imguiConcurrency_->setExternalConcurrency(count);
     }
 
+    void EpdData::setAutoConcurrency(bool autoMode) {
+        imguiConcurrency_->setAutoMode(autoMode);
+    }
+
+    bool EpdData::isAutoConcurrency() const {
+        return imguiConcurrency_->isAutoMode();
+    }
+
+    uint32_t EpdData::getCurrentConcurrency() const {
+        return imguiConcurrency_->getCurrentConcurrency();
+    }
+
     void EpdData::setPoolConcurrency(uint32_t count, bool nice, bool direct) {
         if (!isRunning() && !isStarting()) {
             return;
@@ -168,6 +200,27 @@ namespace QaplaWindows {
         return std::nullopt;
     }
 
+    size_t EpdData::estimateResultBytes() const {
+        if (!epdResults_) {
+            return 0;
+        }
+        auto stringBytes = [](const std::string& text) {
+            return static_cast<size_t>(MemoryAccounting::stringBytes(text)) - sizeof(std::string);
+        };
+        size_t bytes = epdResults_->capacity() * sizeof(EpdTestResult);
+        for (const auto& result : *epdResults_) {
+            bytes += stringBytes(result.engineName);
+            bytes += result.result.capacity() * sizeof(result.result.front());
+            for (const auto& test : result.result) {
+                bytes += stringBytes(test.id) + stringBytes(test.fen) + stringBytes(test.playedMove);
+                for (const auto& move : test.bestMoves) {
+                    bytes += static_cast<size_t>(MemoryAccounting::stringBytes(move));
+                }
+            }
+        }
+        return bytes;
+    }
+
     void EpdData::populateTable() {
         if (!epdResults_) {
             return;
@@ -217,13 +270,27 @@ namespace QaplaWindows {
         }
     }
 
-    void EpdData::pollData() {
+    void EpdData::ensureLoaded() {
+        if (loaded_) {
+            return;
+        }
+        loaded_ = true;
+        loadFile();
+        updateResults();
+    }
+
+    void EpdData::updateResults() {
         if (updateCnt_ != epdManager_->getUpdateCount()) {
 			epdResults_ = std::make_unique<std::vector<EpdTestResult>>(epdManager_->getResultsCopy());
             updateCnt_ = epdManager_->getUpdateCount();
             setModified(); // Notify autosave system about data changes
             populateTable();
 		}
+    }
+
+    void EpdData::pollData() {
+        imguiConcurrency_->poll();
+        updateResults();
         if (state == State::Starting && poolAccess_->runningGameCount() > 0) {
             state = State::Running;
         }
@@ -295,6 +362,7 @@ namespace QaplaWindows {
     }
 
     void EpdData::analyse() {
+        ensureLoaded();
         if (!mayAnalyze(true)) {
             return;
         }
@@ -313,6 +381,8 @@ namespace QaplaWindows {
         }
         
         imguiConcurrency_->init();
+        imguiConcurrency_->setResourceLimit(
+            ResourceBudget::instance().maxConcurrentSingles(epdConfig_.engines));
         imguiConcurrency_->setActive(true);
         
         // Apply the external concurrency setting
@@ -355,6 +425,7 @@ namespace QaplaWindows {
     }
 
     void EpdData::clear() {
+        ensureLoaded();
         poolAccess_->clearAll();
         epdManager_->clear();
         epdResults_->clear();
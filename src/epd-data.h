@@ -53,8 +53,9 @@ namespace QaplaWindows {
         struct EpdConfig {
             std::string filepath;
             std::vector<QaplaTester::EngineConfig> engines;
-            uint32_t maxConcurrency = 32;
+            uint32_t maxConcurrency = 256;
             uint32_t concurrency = 1;
+            bool autoConcurrency = false;
             uint64_t maxTimeInS = 10;
             uint64_t minTimeInS = 1;
             uint32_t seenPlies = 3;
@@ -79,6 +80,20 @@ namespace QaplaWindows {
 		 */
         void pollData();
 
+        /**
+         * @brief Marks the window showing the data as drawn in the current frame.
+         * Visible data is polled every frame, hidden data at background rate.
+         */
+        void markDrawn() {
+            visibility_.markDrawn();
+        }
+
+        /**
+         * @brief Loads the saved results on first use instead of at startup, as this
+         * re-reads the EPD file. Called when the Epd tab or the chatbot needs the results.
+         */
+        void ensureLoaded();
+
         /**
          * @brief Checks if analysis may be started or continued, and starts it if possible.
          * @param sendMessage If true, shows a message if analysis cannot be started.
@@ -133,12 +148,37 @@ namespace QaplaWindows {
          */
         uint32_t getExternalConcurrency() const;
 
+        /**
+         * @brief Gets the number of concurrent games fitting into the resource budget.
+         * @return The game limit of the running calculation.
+         */
+        uint32_t getResourceLimit() const;
+
         /**
          * @brief Sets the external concurrency value.
          * @param count The new external concurrency value.
          */
         void setExternalConcurrency(uint32_t count);
 
+        /**
+         * @brief Enables or disables the adaptive concurrency mode. The concurrency
+         * value then is the upper limit of the automatically chosen concurrency.
+         * @param autoMode True to enable auto mode.
+         */
+        void setAutoConcurrency(bool autoMode);
+
+        /**
+         * @brief Checks if the adaptive concurrency mode is enabled.
+         * @return True if auto mode is enabled.
+         */
+        bool isAutoConcurrency() const;
+
+        /**
+         * @brief Gets the concurrency currently applied to the pool.
+         * @return The applied concurrency.
+         */
+        uint32_t getCurrentConcurrency() const;
+
         /**
          * @brief Sets the pool concurrency level.
          * @param count The number of concurrent tasks to allow.
@@ -272,12 +312,25 @@ namespace QaplaWindows {
         uint64_t updateCnt_ = 0;
 
         void populateTable();
+
+        /**
+         * @brief Copies the results of the EPD manager if they changed.
+         */
+        void updateResults();
+        bool loaded_ = false;
+
+        /**
+         * @brief Estimates the heap bytes of the EPD results.
+         */
+        size_t estimateResultBytes() const;
         std::optional<size_t> selectedIndex_;
 
 		std::shared_ptr<QaplaTester::EpdManager> epdManager_;
 		std::unique_ptr<std::vector<QaplaTester::EpdTestResult>> epdResults_;
    		std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
         std::unique_ptr<Callback::UnregisterHandle> saveCallbackHandle_;
+        std::unique_ptr<Callback::UnregisterHandle> memoryEstimatorHandle_;
+        Visibility visibility_;
         std::unique_ptr<ImGuiEngineSelect> engineSelect_;
         std::unique_ptr<ImGuiConcurrency> imguiConcurrency_;
 
@@ -27,6 +27,7 @@
 #include "imgui-epd-configuration.h"
 #include "epd-data.h"
 #include "configuration.h"
+#include "imgui-concurrency.h"
 
 #include <chess-game/move-record.h>
 #include <chess-game/game-record.h>
@@ -187,15 +188,31 @@ void QaplaWindows::EpdWindow::executeCommand(const std::string &button)
 void EpdWindow::drawInput()
 {
     constexpr float inputWidth = 200.0F;
-    constexpr int maxConcurrency = 32;
 
     auto& epdData = EpdData::instance();
 
     auto concurrency = epdData.getExternalConcurrency();
-    ImGuiControls::sliderInt<uint32_t>("Concurrency", concurrency, 1, maxConcurrency);
+    ImGuiControls::sliderInt<uint32_t>("Concurrency", concurrency, 1, ImGuiConcurrency::maxConcurrency());
     ImGuiControls::hooverTooltip("Number of positions analyzed in parallel");
     epdData.setExternalConcurrency(concurrency);
     epdData.setPoolConcurrency(concurrency, true);
+    ImGui::SameLine();
+    auto autoConcurrency = epdData.isAutoConcurrency();
+    if (ImGuiControls::checkbox("Auto", autoConcurrency)) {
+        epdData.setAutoConcurrency(autoConcurrency);
+    }
+    ImGuiControls::hooverTooltip("Adapts the number of parallel games to the CPU load.\n"
+        "Reduces it when games lose on time, the slider value is the upper limit.");
+    if (epdData.isAutoConcurrency() && epdData.getCurrentConcurrency() > 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(running %u)", epdData.getCurrentConcurrency());
+    }
+    if (epdData.getResourceLimit() < concurrency) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(limited to %u)", epdData.getResourceLimit());
+        ImGuiControls::hooverTooltip("The engines' Threads and Hash settings allow fewer parallel games.\n"
+            "The budget is configured in the Settings tab.");
+    }
 
     ImGui::Spacing();
     const bool highlightEngineSelect = (highlightedSection_ == "EngineSelect");
@@ -230,6 +247,8 @@ void EpdWindow::drawProgress()
 void EpdWindow::draw()
 {
     constexpr float rightBorder = 5.0F;
+    EpdData::instance().ensureLoaded();
+    EpdData::instance().markDrawn();
     auto clickedButton = drawButtons();
     
     if (!clickedButton.empty()) {
@@ -0,0 +1,195 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "file-range-copy.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace QaplaHelpers {
+
+static constexpr size_t COPY_BUFFER_SIZE = 1024 * 1024;
+
+FileRangeCopier::FileRangeCopier(const std::string& sourceFile, const std::string& targetFile, 
+    TargetMode mode)
+    : targetFile_(targetFile) {
+    std::error_code ec;
+    sourceSize_ = std::filesystem::file_size(sourceFile, ec);
+    if (ec) {
+        throw std::runtime_error(std::format("Failed to open file for reading: {}", sourceFile));
+    }
+#ifdef __linux__
+    sourceFd_ = ::open(sourceFile.c_str(), O_RDONLY | O_CLOEXEC);
+    if (sourceFd_ < 0) {
+        throw std::runtime_error(std::format("Failed to open file for reading: {}", sourceFile));
+    }
+    // O_APPEND is not used as copy_file_range rejects such targets, we seek to the end instead
+    int truncate = mode == TargetMode::Truncate ? O_TRUNC : 0;
+    targetFd_ = ::open(targetFile.c_str(), O_WRONLY | O_CREAT | truncate | O_CLOEXEC, 0644);
+    if (targetFd_ < 0 || ::lseek(targetFd_, 0, SEEK_END) < 0) {
+        ::close(sourceFd_);
+        if (targetFd_ >= 0) {
+            ::close(targetFd_);
+        }
+        throw std::runtime_error(std::format("Failed to open file for writing: {}", targetFile));
+    }
+#else
+    source_.open(sourceFile, std::ios::binary);
+    if (!source_.is_open()) {
+        throw std::runtime_error(std::format("Failed to open file for reading: {}", sourceFile));
+    }
+    target_.open(targetFile, 
+        (mode == TargetMode::Truncate ? std::ios::trunc : std::ios::app) | std::ios::binary);
+    if (!target_.is_open()) {
+        throw std::runtime_error(std::format("Failed to open file for writing: {}", targetFile));
+    }
+#endif
+}
+
+FileRangeCopier::~FileRangeCopier() {
+    try {
+        close();
+    } catch (...) {
+        // Destructor must not throw, errors are reported by explicit close() calls
+    }
+}
+
+void FileRangeCopier::close() {
+#ifdef __linux__
+    if (sourceFd_ >= 0) {
+        ::close(sourceFd_);
+        sourceFd_ = -1;
+    }
+    if (targetFd_ >= 0) {
+        int result = ::close(targetFd_);
+        targetFd_ = -1;
+        if (result != 0) {
+            throw std::runtime_error(std::format("Failed to write file: {}", targetFile_));
+        }
+    }
+#else
+    source_.close();
+    if (target_.is_open()) {
+        target_.close();
+        if (target_.fail()) {
+            throw std::runtime_error(std::format("Failed to write file: {}", targetFile_));
+        }
+    }
+#endif
+}
+
+void FileRangeCopier::copy(uint64_t offset, uint64_t length) {
+    if (offset >= sourceSize_) {
+        return;
+    }
+    length = std::min(length, sourceSize_ - offset);
+#ifdef __linux__
+    while (useCopyFileRange_ && length > 0) {
+        auto in = static_cast<off_t>(offset);
+        ssize_t copied = ::copy_file_range(sourceFd_, &in, targetFd_, nullptr, length, 0);
+        if (copied > 0) {
+            offset += static_cast<uint64_t>(copied);
+            length -= static_cast<uint64_t>(copied);
+            continue;
+        }
+        if (copied == 0) {
+            return; // Source shorter than expected
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != ENOSYS && errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP) {
+            throw std::runtime_error(std::format("Failed to write file: {}", targetFile_));
+        }
+        // Not supported for this kernel or file system combination
+        useCopyFileRange_ = false;
+    }
+#endif
+    copyBuffered(offset, length);
+}
+
+void FileRangeCopier::write(std::string_view text) {
+    writeTarget(text.data(), text.size());
+}
+
+void FileRangeCopier::writeTarget(const char* data, size_t size) {
+#ifdef __linux__
+    size_t written = 0;
+    while (written < size) {
+        ssize_t result = ::write(targetFd_, data + written, size - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            throw std::runtime_error(std::format("Failed to write file: {}", targetFile_));
+        }
+        written += static_cast<size_t>(result);
+    }
+#else
+    target_.write(data, static_cast<std::streamsize>(size));
+    if (!target_) {
+        throw std::runtime_error(std::format("Failed to write file: {}", targetFile_));
+    }
+#endif
+}
+
+void FileRangeCopier::copyBuffered(uint64_t offset, uint64_t length) {
+    if (length == 0) {
+        return;
+    }
+    buffer_.resize(COPY_BUFFER_SIZE);
+#ifdef __linux__
+    while (length > 0) {
+        size_t chunk = static_cast<size_t>(std::min<uint64_t>(length, buffer_.size()));
+        ssize_t bytesRead = ::pread(sourceFd_, buffer_.data(), chunk, static_cast<off_t>(offset));
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytesRead <= 0) {
+            return;
+        }
+        writeTarget(buffer_.data(), static_cast<size_t>(bytesRead));
+        offset += static_cast<uint64_t>(bytesRead);
+        length -= static_cast<uint64_t>(bytesRead);
+    }
+#else
+    source_.clear();
+    source_.seekg(static_cast<std::streamoff>(offset));
+    while (length > 0) {
+        auto chunk = static_cast<std::streamsize>(std::min<uint64_t>(length, buffer_.size()));
+        source_.read(buffer_.data(), chunk);
+        std::streamsize bytesRead = source_.gcount();
+        if (bytesRead <= 0) {
+            return;
+        }
+        writeTarget(buffer_.data(), static_cast<size_t>(bytesRead));
+        length -= static_cast<uint64_t>(bytesRead);
+    }
+#endif
+}
+
+} // namespace QaplaHelpers
@@ -0,0 +1,101 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QaplaHelpers {
+
+/**
+ * @brief Copies byte ranges of a source file into a target file.
+ * 
+ * On Linux the ranges are copied with copy_file_range, so the data is moved inside the 
+ * kernel (or the file system) without passing through user space buffers. Other 
+ * platforms and file systems not supporting it fall back to buffered block reads.
+ * Callers should coalesce adjacent ranges to few large copies.
+ */
+class FileRangeCopier {
+public:
+    enum class TargetMode {
+        Truncate,   ///< Creates or truncates the target file
+        Append      ///< Appends to the end of an existing target file
+    };
+
+    /**
+     * @brief Opens the source file for reading and the target file for writing.
+     * @param sourceFile File to copy from.
+     * @param targetFile File to copy to.
+     * @param mode Whether the target file is truncated or appended to.
+     * @throws std::runtime_error if one of the files cannot be opened.
+     */
+    FileRangeCopier(const std::string& sourceFile, const std::string& targetFile, 
+        TargetMode mode = TargetMode::Truncate);
+    ~FileRangeCopier();
+
+    FileRangeCopier(const FileRangeCopier&) = delete;
+    FileRangeCopier& operator=(const FileRangeCopier&) = delete;
+
+    /**
+     * @brief Gets the size of the source file in bytes.
+     */
+    [[nodiscard]] uint64_t sourceSize() const { return sourceSize_; }
+
+    /**
+     * @brief Appends a range of the source file to the target file.
+     * @param offset Start of the range in the source file.
+     * @param length Number of bytes to copy, clipped at the end of the source file.
+     * @throws std::runtime_error on read or write errors.
+     */
+    void copy(uint64_t offset, uint64_t length);
+
+    /**
+     * @brief Appends text to the target file, e.g. a separator between copied ranges.
+     * @param text Text to write.
+     * @throws std::runtime_error on write errors.
+     */
+    void write(std::string_view text);
+
+    /**
+     * @brief Flushes and closes both files. Called by the destructor if not done before.
+     */
+    void close();
+
+private:
+    void copyBuffered(uint64_t offset, uint64_t length);
+    void writeTarget(const char* data, size_t size);
+
+    std::string targetFile_;
+    uint64_t sourceSize_ = 0;
+#ifdef __linux__
+    int sourceFd_ = -1;
+    int targetFd_ = -1;
+    bool useCopyFileRange_ = true;
+#else
+    std::ifstream source_;
+    std::ofstream target_;
+#endif
+    std::vector<char> buffer_;
+};
+
+} // namespace QaplaHelpers
@@ -0,0 +1,332 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "font-atlas-cache.h"
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace FontManager {
+
+#if IMGUI_VERSION_NUM < 19200
+
+namespace {
+    constexpr uint32_t CACHE_MAGIC = 0x43414651;  // "QFAC"
+    constexpr uint32_t CACHE_VERSION = 1;
+    constexpr int MAX_TEXTURE_SIZE = 16384;
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    class Hasher {
+    public:
+        void bytes(const void* data, size_t size) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash_ ^= bytes[i];
+                hash_ *= FNV_PRIME;
+            }
+        }
+
+        template <typename T>
+        void value(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            bytes(&value, sizeof(T));
+        }
+
+        [[nodiscard]] uint64_t result() const {
+            return hash_;
+        }
+
+    private:
+        uint64_t hash_ = FNV_OFFSET_BASIS;
+    };
+
+    class Writer {
+    public:
+        explicit Writer(std::ostream& out) : out_(out) {}
+
+        template <typename T>
+        void value(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            out_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        void array(const T* data, size_t count) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            value(static_cast<uint64_t>(count));
+            if (count > 0) {
+                out_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+            }
+        }
+
+    private:
+        std::ostream& out_;
+    };
+
+    class Reader {
+    public:
+        explicit Reader(std::istream& in) : in_(in) {}
+
+        template <typename T>
+        bool value(T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            in_.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return static_cast<bool>(in_);
+        }
+
+        /**
+         * @brief Reads an array written by Writer::array with at most maxCount elements.
+         */
+        template <typename T>
+        bool array(std::vector<T>& data, uint64_t maxCount) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            uint64_t count = 0;
+            if (!value(count) || count > maxCount) {
+                return false;
+            }
+            data.resize(static_cast<size_t>(count));
+            if (count > 0) {
+                in_.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(count * sizeof(T)));
+            }
+            return static_cast<bool>(in_);
+        }
+
+    private:
+        std::istream& in_;
+    };
+
+    struct CachedFont {
+        float ascent = 0.0F;
+        float descent = 0.0F;
+        std::vector<ImFontGlyph> glyphs;
+    };
+
+    struct CachedAtlas {
+        int width = 0;
+        int height = 0;
+        ImVec2 uvScale;
+        ImVec2 uvWhitePixel;
+        std::vector<ImVec4> uvLines;
+        int packIdMouseCursor = -1;
+        int packIdLines = -1;
+        std::vector<ImFontAtlasCustomRect> customRects;
+        std::vector<unsigned char> pixels;
+        std::vector<CachedFont> fonts;
+    };
+
+    constexpr size_t UV_LINES = IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1;
+
+    bool readAtlas(std::istream& in, uint64_t key, CachedAtlas& atlas) {
+        Reader reader(in);
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t fileKey = 0;
+        if (!reader.value(magic) || magic != CACHE_MAGIC || !reader.value(version) || version != CACHE_VERSION
+            || !reader.value(fileKey) || fileKey != key) {
+            return false;
+        }
+        if (!reader.value(atlas.width) || !reader.value(atlas.height) 
+            || atlas.width <= 0 || atlas.height <= 0 
+            || atlas.width > MAX_TEXTURE_SIZE || atlas.height > MAX_TEXTURE_SIZE) {
+            return false;
+        }
+        if (!reader.value(atlas.uvScale) || !reader.value(atlas.uvWhitePixel)
+            || !reader.array(atlas.uvLines, UV_LINES) || atlas.uvLines.size() != UV_LINES) {
+            return false;
+        }
+        if (!reader.value(atlas.packIdMouseCursor) || !reader.value(atlas.packIdLines)
+            || !reader.array(atlas.customRects, 1024)) {
+            return false;
+        }
+        auto pixelCount = static_cast<uint64_t>(atlas.width) * static_cast<uint64_t>(atlas.height);
+        if (!reader.array(atlas.pixels, pixelCount) || atlas.pixels.size() != pixelCount) {
+            return false;
+        }
+        uint32_t fontCount = 0;
+        if (!reader.value(fontCount) || fontCount > 1024) {
+            return false;
+        }
+        atlas.fonts.resize(fontCount);
+        for (auto& font : atlas.fonts) {
+            if (!reader.value(font.ascent) || !reader.value(font.descent) 
+                || !reader.array(font.glyphs, 0x110000)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+uint64_t FontAtlasCache::computeKey(const ImFontAtlas& atlas) {
+    Hasher hasher;
+    hasher.value(CACHE_VERSION);
+    hasher.value(static_cast<int>(IMGUI_VERSION_NUM));
+    hasher.value(sizeof(ImFontGlyph));
+    hasher.value(sizeof(ImFontAtlasCustomRect));
+    hasher.value(sizeof(ImFontConfig));
+    hasher.value(atlas.Flags);
+    hasher.value(atlas.TexDesiredWidth);
+    hasher.value(atlas.TexGlyphPadding);
+    hasher.value(atlas.ConfigData.Size);
+    for (const auto& config : atlas.ConfigData) {
+        hasher.bytes(config.FontData, static_cast<size_t>(config.FontDataSize));
+        for (const ImWchar* range = config.GlyphRanges; range != nullptr && *range != 0; ++range) {
+            hasher.value(*range);
+        }
+        // All settings of the configuration: sizes, oversampling, offsets, rasterizer flags.
+        // ImFontConfig is zero initialized, pointers are cleared as they differ per run.
+        std::array<unsigned char, sizeof(ImFontConfig)> settings{};
+        std::memcpy(settings.data(), &config, sizeof(ImFontConfig));
+        auto* copy = reinterpret_cast<ImFontConfig*>(settings.data());
+        copy->FontData = nullptr;
+        copy->GlyphRanges = nullptr;
+        copy->DstFont = nullptr;
+        copy->FontDataOwnedByAtlas = false;
+        hasher.bytes(settings.data(), settings.size());
+    }
+    return hasher.result();
+}
+
+bool FontAtlasCache::save(const ImFontAtlas& atlas, const std::string& fileName) {
+    if (!atlas.IsBuilt() || atlas.TexPixelsAlpha8 == nullptr || atlas.TexPixelsUseColors) {
+        return false;
+    }
+    for (const auto& rect : atlas.CustomRects) {
+        // Custom glyphs refer to their font by pointer
+        if (rect.Font != nullptr) {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(fileName).parent_path(), error);
+    auto tempName = fileName + ".tmp";
+    {
+        std::ofstream out(tempName, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        Writer writer(out);
+        writer.value(CACHE_MAGIC);
+        writer.value(CACHE_VERSION);
+        writer.value(computeKey(atlas));
+        writer.value(atlas.TexWidth);
+        writer.value(atlas.TexHeight);
+        writer.value(atlas.TexUvScale);
+        writer.value(atlas.TexUvWhitePixel);
+        writer.array(atlas.TexUvLines, UV_LINES);
+        writer.value(atlas.PackIdMouseCursor);
+        writer.value(atlas.PackIdLines);
+        writer.array(atlas.CustomRects.Data, static_cast<size_t>(atlas.CustomRects.Size));
+        writer.array(atlas.TexPixelsAlpha8, static_cast<size_t>(atlas.TexWidth) * static_cast<size_t>(atlas.TexHeight));
+        writer.value(static_cast<uint32_t>(atlas.Fonts.Size));
+        for (const ImFont* font : atlas.Fonts) {
+            writer.value(font->Ascent);
+            writer.value(font->Descent);
+            writer.array(font->Glyphs.Data, static_cast<size_t>(font->Glyphs.Size));
+        }
+        if (!out) {
+            return false;
+        }
+    }
+    std::filesystem::rename(tempName, fileName, error);
+    if (error) {
+        std::filesystem::remove(tempName, error);
+        return false;
+    }
+    return true;
+}
+
+bool FontAtlasCache::load(ImFontAtlas& atlas, const std::string& fileName) {
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in || atlas.Fonts.empty() || atlas.IsBuilt()) {
+        return false;
+    }
+    CachedAtlas cached;
+    if (!readAtlas(in, computeKey(atlas), cached) || cached.fonts.size() != static_cast<size_t>(atlas.Fonts.Size)) {
+        return false;
+    }
+
+    atlas.ClearTexData();
+    atlas.TexWidth = cached.width;
+    atlas.TexHeight = cached.height;
+    atlas.TexUvScale = cached.uvScale;
+    atlas.TexUvWhitePixel = cached.uvWhitePixel;
+    std::memcpy(atlas.TexUvLines, cached.uvLines.data(), UV_LINES * sizeof(ImVec4));
+    atlas.PackIdMouseCursor = cached.packIdMouseCursor;
+    atlas.PackIdLines = cached.packIdLines;
+    atlas.CustomRects.resize(static_cast<int>(cached.customRects.size()));
+    if (!cached.customRects.empty()) {
+        std::memcpy(atlas.CustomRects.Data, cached.customRects.data(), 
+            cached.customRects.size() * sizeof(ImFontAtlasCustomRect));
+    }
+    atlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(cached.pixels.size()));
+    std::memcpy(atlas.TexPixelsAlpha8, cached.pixels.data(), cached.pixels.size());
+    atlas.TexPixelsUseColors = false;
+
+    // Same font setup as the build, see ImFontAtlasBuildSetupFont
+    for (auto& config : atlas.ConfigData) {
+        ImFont* font = config.DstFont;
+        if (!config.MergeMode) {
+            font->ClearOutputData();
+            font->FontSize = config.SizePixels;
+            font->ConfigData = &config;
+            font->ConfigDataCount = 0;
+            font->ContainerAtlas = &atlas;
+        }
+        font->ConfigDataCount++;
+    }
+    for (int index = 0; index < atlas.Fonts.Size; ++index) {
+        ImFont* font = atlas.Fonts[index];
+        auto& source = cached.fonts[static_cast<size_t>(index)];
+        font->Ascent = source.ascent;
+        font->Descent = source.descent;
+        font->Glyphs.resize(static_cast<int>(source.glyphs.size()));
+        if (!source.glyphs.empty()) {
+            std::memcpy(font->Glyphs.Data, source.glyphs.data(), source.glyphs.size() * sizeof(ImFontGlyph));
+        }
+        font->BuildLookupTable();
+    }
+    atlas.TexReady = true;
+    return true;
+}
+
+#else
+
+uint64_t FontAtlasCache::computeKey([[maybe_unused]] const ImFontAtlas& atlas) {
+    return 0;
+}
+
+bool FontAtlasCache::load([[maybe_unused]] ImFontAtlas& atlas, [[maybe_unused]] const std::string& fileName) {
+    return false;
+}
+
+bool FontAtlasCache::save([[maybe_unused]] const ImFontAtlas& atlas, [[maybe_unused]] const std::string& fileName) {
+    return false;
+}
+
+#endif
+
+} // namespace FontManager
@@ -0,0 +1,61 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <imgui.h>
+
+#include <cstdint>
+#include <string>
+
+namespace FontManager {
+
+/**
+ * @brief Stores a built font atlas on disk and restores it without rasterizing the fonts.
+ *
+ * The file holds the alpha8 texture, the texture coordinates of the baked lines, the 
+ * custom rectangles and the glyph tables of every font. It is keyed by a hash over the
+ * ImGui version, the font data and every setting of the font configurations that changes
+ * the rasterization, including the pixel sizes, so a different DPI scale or font creates
+ * a new atlas. A cache that does not match is ignored and overwritten after the next build.
+ * 
+ * Fonts are added to the atlas as usual; load() replaces only the build step. ImGui 1.92 
+ * and later rasterize glyphs on demand, there the cache is disabled.
+ */
+class FontAtlasCache {
+public:
+    /**
+     * @brief Hash over everything that influences the built atlas.
+     */
+    static uint64_t computeKey(const ImFontAtlas& atlas);
+
+    /**
+     * @brief Restores the built state of an atlas, whose fonts are added but not built.
+     * @return False, if the file is missing, outdated or invalid. The atlas is then unchanged.
+     */
+    static bool load(ImFontAtlas& atlas, const std::string& fileName);
+
+    /**
+     * @brief Writes a built atlas.
+     * @return False, if the atlas is not built, uses colored glyphs or cannot be written.
+     */
+    static bool save(const ImFontAtlas& atlas, const std::string& fileName);
+};
+
+} // namespace FontManager
@@ -18,6 +18,8 @@
  */
 
 #include "font.h"
+#include "font-atlas-cache.h"
+#include "os-helpers.h"
 #include "data/chess-font.h"
 #include "data/inter-variable.h"
 #include "data/ibm-plex-mono-font.h"
@@ -139,6 +141,13 @@ namespace FontManager {
             &fontCfg
         );
 
+        // Rasterizing the fonts is the most expensive part of the startup, reuse the last atlas
+        auto cacheFile = (std::filesystem::path(QaplaHelpers::OsHelpers::getConfigDirectory()) 
+            / "font-atlas.cache").string();
+        if (!FontAtlasCache::load(*imguiIO.Fonts, cacheFile)) {
+            imguiIO.Fonts->Build();
+            FontAtlasCache::save(*imguiIO.Fonts, cacheFile);
+        }
 
         imguiIO.FontDefault = imguiIO.Fonts->Fonts[interVariableIndex]; 
     }
@@ -19,6 +19,7 @@
 
 #include "game-record-manager.h"
 #include "pgn-auto-saver.h"
+#include "file-range-copy.h"
 #include <algorithm>
 #include <fstream>
 #include <filesystem>
@@ -27,18 +28,64 @@
 using QaplaTester::GameRecord;
 using QaplaTester::PgnIO;
 
+using QaplaWindows::BinaryGameReader;
+using QaplaWindows::BinaryGameWriter;
+
 void GameRecordManager::load(const std::string& fileName, std::function<bool(const GameRecord&, float)> gameCallback) {
-    games_ = pgnIO_.loadGames(fileName, true, gameCallback);  // Load without comments
+    binarySource_ = BinaryGameReader::isBinaryGameFile(fileName);
+    if (binarySource_) {
+        games_ = binaryReader_.load(fileName, gameCallback);
+    } else {
+        games_ = pgnIO_.loadGames(fileName, true, gameCallback);  // Load without comments
+    }
+    updateMemoryAccount();
+}
+
+void GameRecordManager::updateMemoryAccount() {
+    using QaplaWindows::MemoryAccounting;
+    auto bytes = static_cast<int64_t>(games_.capacity() * sizeof(GameRecord));
+    for (const auto& game : games_) {
+        for (const auto& [key, value] : game.getTags()) {
+            // Map node with two pointers for the tree structure
+            bytes += MemoryAccounting::stringBytes(key) + MemoryAccounting::stringBytes(value)
+                + static_cast<int64_t>(2 * sizeof(void*));
+        }
+        const auto& history = game.history();
+        bytes += static_cast<int64_t>((history.capacity() - history.size()) * sizeof(QaplaTester::MoveRecord));
+        for (const auto& move : history) {
+            bytes += static_cast<int64_t>(sizeof(move)) 
+                + MemoryAccounting::stringBytes(move.lan_) - static_cast<int64_t>(sizeof(std::string))
+                + MemoryAccounting::stringBytes(move.san_) - static_cast<int64_t>(sizeof(std::string));
+        }
+    }
+    memory_.set(bytes);
 }
 
 std::optional<GameRecord> GameRecordManager::loadGameByIndex(size_t index) {
+    if (binarySource_) {
+        return binaryReader_.loadGameAtIndex(index);
+    }
     return pgnIO_.loadGameAtIndex(index);
 }
 
 std::optional<std::string> GameRecordManager::getRawGameText(size_t index) {
+    if (binarySource_) {
+        return std::nullopt;
+    }
     return pgnIO_.getRawGameText(index);
 }
 
+std::vector<QaplaWindows::AdjudicationSimulator::GameEvals> GameRecordManager::loadAdjudicationData(
+    const std::function<bool()>& cancelCheck, std::atomic<size_t>& loaded) const {
+    using QaplaWindows::AdjudicationSimulator;
+    if (binarySource_) {
+        return AdjudicationSimulator::loadIndexed(games_.size(), 
+            [this](size_t index) { return binaryReader_.loadGameAtIndex(index); }, cancelCheck, loaded);
+    }
+    return AdjudicationSimulator::loadPgn(pgnIO_.getCurrentFileName(), pgnIO_.getGamePositions(), 
+        cancelCheck, loaded);
+}
+
 std::vector<std::pair<std::string, size_t>> GameRecordManager::getMostCommonTags(size_t topN) const {
     std::map<std::string, size_t> tagCounts;
     
@@ -67,7 +114,7 @@ size_t GameRecordManager::save(const std::string& fileName,
                                 const QaplaWindows::GameFilterData& filterData,
                                 std::function<void(size_t, float)> progressCallback,
                                 std::function<bool()> cancelCheck) {
-    const std::string& sourceFile = pgnIO_.getCurrentFileName();
+    const std::string& sourceFile = getCurrentFileName();
     
     // Check if source and target are the same file
     if (!sourceFile.empty() && 
@@ -75,6 +122,11 @@ size_t GameRecordManager::save(const std::string& fileName,
         return saveToSameFile(fileName, filterData, progressCallback, cancelCheck);
     }
     
+    // Different formats need every game to be decoded and written again
+    if (binarySource_ != BinaryGameReader::isBinaryGameFile(fileName)) {
+        return saveConverted(fileName, filterData, progressCallback, cancelCheck);
+    }
+
     // Check if filter is active
     bool hasFilter = filterData.hasActiveFilters();
     
@@ -82,6 +134,8 @@ size_t GameRecordManager::save(const std::string& fileName,
         // No filtering needed - just copy
         saveWithoutFilter(fileName);
         return games_.size();
+    } else if (binarySource_) {
+        return saveConverted(fileName, filterData, progressCallback, cancelCheck);
     } else {
         return saveWithFilter(fileName, filterData, progressCallback, cancelCheck);
     }
@@ -91,13 +145,15 @@ size_t GameRecordManager::saveToSameFile(const std::string& fileName,
                                           const QaplaWindows::GameFilterData& filterData,
                                           std::function<void(size_t, float)> progressCallback,
                                           std::function<bool()> cancelCheck) {
-    // Create temporary file name
+    // Create temporary file name, keeping the extension as it selects the file format
     std::filesystem::path filePath(fileName);
     std::filesystem::path tempPath = filePath;
-    tempPath.replace_filename(filePath.stem().string() + ".tmp");
+    tempPath.replace_filename(filePath.stem().string() + ".tmp" + filePath.extension().string());
     
     // Save filtered games to temp file
-    size_t gamesSaved = saveWithFilter(tempPath.string(), filterData, progressCallback, cancelCheck);
+    size_t gamesSaved = binarySource_
+        ? saveConverted(tempPath.string(), filterData, progressCallback, cancelCheck)
+        : saveWithFilter(tempPath.string(), filterData, progressCallback, cancelCheck);
     
     // Check if operation was cancelled
     if (!cancelCheck || !cancelCheck()) {
@@ -115,7 +171,7 @@ size_t GameRecordManager::saveToSameFile(const std::string& fileName,
 }
 
 void GameRecordManager::saveWithoutFilter(const std::string& fileName) {
-    const std::string& sourceFile = pgnIO_.getCurrentFileName();
+    const std::string& sourceFile = getCurrentFileName();
     if (!sourceFile.empty()) {
         std::ifstream src(sourceFile, std::ios::binary);
         std::ofstream dst(fileName, std::ios::binary);
@@ -129,6 +185,57 @@ size_t GameRecordManager::saveWithFilter(const std::string& fileName,
                                           const QaplaWindows::GameFilterData& filterData,
                                           std::function<void(size_t, float)> progressCallback,
                                           std::function<bool()> cancelCheck) {
+    const std::string& sourceFile = pgnIO_.getCurrentFileName();
+    const auto& positions = pgnIO_.getGamePositions();
+    if (sourceFile.empty() || positions.size() != games_.size()) {
+        return saveWithFilterGameByGame(fileName, filterData, progressCallback, cancelCheck);
+    }
+
+    // Flushing long runs early keeps progress and cancellation responsive
+    constexpr uint64_t MAX_RUN_BYTES = 64ULL * 1024 * 1024;
+    QaplaHelpers::FileRangeCopier copier(sourceFile, fileName);
+    const uint64_t sourceSize = copier.sourceSize();
+    auto gameStart = [&](size_t index) {
+        return index < positions.size() 
+            ? static_cast<uint64_t>(static_cast<std::streamoff>(positions[index])) 
+            : sourceSize;
+    };
+
+    size_t gamesSaved = 0;
+    size_t totalGames = games_.size();
+    uint64_t runStart = 0;
+    uint64_t runEnd = 0;
+
+    // Contiguous passing games are coalesced into one range copy
+    for (size_t i = 0; i < totalGames; ++i) {
+        if (cancelCheck && cancelCheck()) {
+            break;
+        }
+        if (!filterData.passesFilter(games_[i])) {
+            continue;
+        }
+        uint64_t start = gameStart(i);
+        uint64_t end = gameStart(i + 1);
+        if (start != runEnd || runEnd - runStart >= MAX_RUN_BYTES) {
+            copier.copy(runStart, runEnd - runStart);
+            runStart = start;
+        }
+        runEnd = end;
+        gamesSaved++;
+
+        if (progressCallback) {
+            progressCallback(gamesSaved, static_cast<float>(i + 1) / static_cast<float>(totalGames));
+        }
+    }
+    copier.copy(runStart, runEnd - runStart);
+    copier.close();
+    return gamesSaved;
+}
+
+size_t GameRecordManager::saveWithFilterGameByGame(const std::string& fileName,
+                                          const QaplaWindows::GameFilterData& filterData,
+                                          std::function<void(size_t, float)> progressCallback,
+                                          std::function<bool()> cancelCheck) {
     // Open file for writing in binary mode to preserve line endings
     std::ofstream outFile(fileName, std::ios::trunc | std::ios::binary);
     if (!outFile.is_open()) {
@@ -171,6 +278,52 @@ size_t GameRecordManager::saveWithFilter(const std::string& fileName,
     return gamesSaved;
 }
 
+size_t GameRecordManager::saveConverted(const std::string& fileName,
+                                         const QaplaWindows::GameFilterData& filterData,
+                                         std::function<void(size_t, float)> progressCallback,
+                                         std::function<bool()> cancelCheck) {
+    std::optional<BinaryGameWriter> binaryWriter;
+    if (BinaryGameReader::isBinaryGameFile(fileName)) {
+        binaryWriter.emplace(fileName);
+    } else {
+        // PgnSave appends, so the target is truncated first
+        std::ofstream outFile(fileName, std::ios::trunc | std::ios::binary);
+        if (!outFile.is_open()) {
+            throw std::runtime_error(
+                std::format("Failed to open file for writing: {}", fileName)
+            );
+        }
+    }
+
+    size_t gamesSaved = 0;
+    size_t totalGames = games_.size();
+    for (size_t i = 0; i < totalGames; ++i) {
+        if (cancelCheck && cancelCheck()) {
+            break;
+        }
+        if (!filterData.passesFilter(games_[i])) {
+            continue;
+        }
+        // The list records lack comments and SAN, so the complete game is read again
+        auto game = loadGameByIndex(i);
+        if (game) {
+            if (binaryWriter) {
+                binaryWriter->addGame(*game);
+            } else {
+                pgnSave_.saveGame(fileName, *game);
+            }
+            gamesSaved++;
+        }
+        if (progressCallback) {
+            progressCallback(gamesSaved, static_cast<float>(i + 1) / static_cast<float>(totalGames));
+        }
+    }
+    if (binaryWriter) {
+        binaryWriter->finish();
+    }
+    return gamesSaved;
+}
+
 void GameRecordManager::appendGame(const std::string& fileName, const QaplaTester::GameRecord& game) {
     pgnSave_.saveGame(fileName, game);
 }
@@ -23,25 +23,29 @@
 #include <opening/pgn-io.h>
 #include <opening/pgn-save.h>
 #include "game-filter-data.h"
+#include "binary-game-store.h"
+#include "adjudication-simulator.h"
+#include "memory-accounting.h"
 
 #include <string>
 #include <vector>
 #include <functional>
+#include <atomic>
 
 namespace QaplaWindows {
     class GameFilterData;
 }
 
 /**
- * @brief Manages a collection of GameRecords loaded from PGN files.
+ * @brief Manages a collection of GameRecords loaded from PGN files or binary game stores (.qgb).
  */
 class GameRecordManager {
 public:
     GameRecordManager() = default;
 
     /**
-     * @brief Loads games from a PGN file using PgnIO.
-     * @param fileName Name of the PGN file to load.
+     * @brief Loads games from a PGN file using PgnIO or from a binary game store (.qgb).
+     * @param fileName Name of the file to load.
      * @param gameCallback Optional callback function called for each loaded game.
      */
     void load(const std::string& fileName, std::function<bool(const QaplaTester::GameRecord&, float)> gameCallback = nullptr);
@@ -79,11 +83,23 @@ public:
      */
     [[nodiscard]] std::optional<std::string> getRawGameText(size_t index);
 
+    /**
+     * @brief Loads evaluations, move times and results of all loaded games for the 
+     * adjudication simulation. The games are decoded in parallel, including comments.
+     * @param cancelCheck Thread safe function returning true to stop loading.
+     * @param loaded Number of games loaded so far, updated while loading.
+     * @return The finished games.
+     */
+    [[nodiscard]] std::vector<QaplaWindows::AdjudicationSimulator::GameEvals> loadAdjudicationData(
+        const std::function<bool()>& cancelCheck, std::atomic<size_t>& loaded) const;
+
     /**
      * @brief Gets the filename of the currently loaded PGN file.
      * @return Reference to the current filename string.
      */
-    [[nodiscard]] const std::string& getCurrentFileName() const { return pgnIO_.getCurrentFileName(); }
+    [[nodiscard]] const std::string& getCurrentFileName() const { 
+        return binarySource_ ? binaryReader_.getCurrentFileName() : pgnIO_.getCurrentFileName(); 
+    }
 
     /**
      * @brief Appends a single game to an existing PGN file.
@@ -102,6 +118,7 @@ public:
 
     /**
      * @brief Saves games to a file, handling special cases like same-file save.
+     * The target format is chosen by the file extension (.qgb for binary game stores, else PGN).
      * @param fileName Target filename to save to.
      * @param filterData Filter configuration to apply.
      * @param progressCallback Callback for progress updates (gamesProcessed, progress 0-1).
@@ -135,6 +152,9 @@ private:
 
     /**
      * @brief Saves filtered games to a file.
+     * 
+     * Runs of consecutive games passing the filter are copied as one byte range of the
+     * source file, so large exports run at disk speed.
      * @param fileName Target filename.
      * @param filterData Filter configuration to apply.
      * @param progressCallback Callback for progress updates.
@@ -146,7 +166,43 @@ private:
                           std::function<void(size_t, float)> progressCallback,
                           std::function<bool()> cancelCheck);
 
+    /**
+     * @brief Saves filtered games by reading and writing the raw text of each game.
+     * Used if the game positions in the source file are not available.
+     * @param fileName Target filename.
+     * @param filterData Filter configuration to apply.
+     * @param progressCallback Callback for progress updates.
+     * @param cancelCheck Function to check if operation should be cancelled.
+     * @return Number of games saved.
+     */
+    [[nodiscard]] size_t saveWithFilterGameByGame(const std::string& fileName,
+                          const QaplaWindows::GameFilterData& filterData,
+                          std::function<void(size_t, float)> progressCallback,
+                          std::function<bool()> cancelCheck);
+
+    /**
+     * @brief Saves filtered games by decoding each game completely and writing it in the 
+     * format of the target file. Used if source and target formats differ.
+     * @param fileName Target filename.
+     * @param filterData Filter configuration to apply.
+     * @param progressCallback Callback for progress updates.
+     * @param cancelCheck Function to check if operation should be cancelled.
+     * @return Number of games saved.
+     */
+    [[nodiscard]] size_t saveConverted(const std::string& fileName,
+                          const QaplaWindows::GameFilterData& filterData,
+                          std::function<void(size_t, float)> progressCallback,
+                          std::function<bool()> cancelCheck);
+
+    /**
+     * @brief Updates the memory account with an estimate of the loaded game records.
+     */
+    void updateMemoryAccount();
+
     std::vector<QaplaTester::GameRecord> games_;  // Loaded game records
+    QaplaWindows::MemoryAccounting::Account memory_{"Game records"};  // Accounts the bytes of games_
     QaplaTester::PgnIO pgnIO_;  // PGN load handler
     QaplaTester::PgnSave pgnSave_;  // PGN save handler
+    QaplaWindows::BinaryGameReader binaryReader_;  // Binary game store load handler
+    bool binarySource_ = false;  // True, if the games were loaded from a binary game store
 };
\ No newline at end of file
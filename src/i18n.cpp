@@ -2,6 +2,7 @@
 #include "callback-manager.h"
 #include "translation-normalizer.h"
 #include "translation-key.h"
+#include "memory-accounting.h"
 
 #include <base-elements/string-helper.h>
 #include <base-elements/logger.h>
@@ -39,6 +40,24 @@ Translator::Translator()
     saveCallbackHandle_ = StaticCallbacks::save().registerCallback([this]() {
         this->saveFile();
     });
+    memoryEstimatorHandle_ = MemoryAccounting::instance().registerEstimator("Translations",
+        [this]() { return estimateTranslationBytes(); });
+}
+
+size_t Translator::estimateTranslationBytes() const {
+    // Hash nodes hold the key, the value, a next pointer and the cached hash
+    constexpr size_t NODE_OVERHEAD = 2 * sizeof(void*);
+    std::scoped_lock lock(languageMutex);
+    size_t bytes = translations.bucket_count() * sizeof(void*);
+    for (const auto& [topic, map] : translations) {
+        bytes += static_cast<size_t>(MemoryAccounting::stringBytes(topic)) + sizeof(TranslationMap) + NODE_OVERHEAD;
+        bytes += map.bucket_count() * sizeof(void*);
+        for (const auto& [key, value] : map) {
+            bytes += static_cast<size_t>(MemoryAccounting::stringBytes(key) + MemoryAccounting::stringBytes(value))
+                + NODE_OVERHEAD;
+        }
+    }
+    return bytes;
 }
 
 Translator::~Translator() {
@@ -108,6 +108,11 @@ private:
 
     void loadLanguageFromStream(std::istream& stream);
 
+    /**
+     * @brief Estimates the heap bytes of the loaded translations.
+     */
+    [[nodiscard]] size_t estimateTranslationBytes() const;
+
 #ifdef QAPLA_DEBUG_I18N
     /**
      * @brief Marks a translation for timestamp update (deferred until save).
@@ -152,6 +157,7 @@ private:
     std::vector<std::string> loadedLanguages;
 
     std::unique_ptr<Callback::UnregisterHandle> saveCallbackHandle_;
+    std::unique_ptr<Callback::UnregisterHandle> memoryEstimatorHandle_;
 };
 
 /**
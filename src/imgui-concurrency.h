@@ -20,14 +20,20 @@
 #pragma once
 
 #include "snackbar.h"
+#include "cpu-affinity.h"
+#include "adaptive-concurrency.h"
+#include "resource-budget.h"
 
 #include "game-manager-pool-access.h"
 
+#include <algorithm>
 #include <thread>
 #include <atomic>
+#include <limits>
 #include <utility>
 
 constexpr int DEBOUNCE_FRAMES = 10;
+constexpr uint32_t MIN_MAX_CONCURRENCY = 32;
 
 /**
  * @class ImGuiConcurrency
@@ -49,6 +55,7 @@ public:
         currentConcurrency_ = 0;
         targetConcurrency_ = 0;
         debounceCounter_ = 0;
+        adaptive_.reset(0);
     }
 
     /**
@@ -61,23 +68,38 @@ public:
 
     /**
      * @brief Updates the concurrency value based on user input.
+     * The change is applied by poll() after the debounce frames. In auto mode the value is
+     * the upper limit for the adaptive controller.
      * @param newConcurrency The new concurrency value from the ImGui slider.
      * @param direct If true, applies the change immediately without debouncing.
      */
     void update(uint32_t newConcurrency, bool direct = false) {
         if (!active_) return;
         setExternalConcurrency(newConcurrency);
-
-        if (newConcurrency != targetConcurrency_) {
-            targetConcurrency_ = newConcurrency;
-            debounceCounter_ = DEBOUNCE_FRAMES; // Reset debounce counter
+        if (newConcurrency == 0) {
+            setTarget(0, true);
+            return;
         }
-
-        if (newConcurrency == 0 || direct) {
-            adjustConcurrency();
+        if (autoMode_) {
+            // Lowering the limit must not wait for the next evaluation of the controller
+            setTarget(std::min(targetConcurrency_, std::min(externalConcurrency_, resourceLimit_)), direct);
             return;
         }
+        setTarget(std::min(newConcurrency, resourceLimit_), direct);
+    }
 
+    /**
+     * @brief Lets the adaptive controller sample the pool and applies pending concurrency 
+     * changes once debounced. Called every poll of the owning data object, so changes are
+     * applied while the window with the concurrency slider is not drawn.
+     */
+    void poll() {
+        if (!active_) {
+            return;
+        }
+        if (autoMode_) {
+            setTarget(adaptive_.poll(poolAccess_, std::min(externalConcurrency_, resourceLimit_)), false);
+        }
         if (debounceCounter_ > 0) {
             --debounceCounter_;
             if (debounceCounter_ == 0) {
@@ -116,7 +138,62 @@ public:
      * @param count The new external concurrency value.
      */
     void setExternalConcurrency(uint32_t count) {
-        externalConcurrency_ = std::clamp(count, 1U, 32U);
+        externalConcurrency_ = std::clamp(count, 1U, maxConcurrency());
+    }
+
+    /**
+     * @brief Gets the upper limit for the UI concurrency value. 
+     * At least 32, raised to the number of cores of the resource budget on larger machines.
+     * @return The maximal concurrency.
+     */
+    static uint32_t maxConcurrency() {
+        return std::max(MIN_MAX_CONCURRENCY, QaplaWindows::ResourceBudget::instance().coreBudget());
+    }
+
+    /**
+     * @brief Sets the maximal number of games fitting into the resource budget. 
+     * The pool concurrency never exceeds this limit, independent of the UI value.
+     * @param limit The game limit.
+     */
+    void setResourceLimit(uint32_t limit) {
+        resourceLimit_ = std::max(1U, limit);
+    }
+
+    /**
+     * @brief Gets the maximal number of games fitting into the resource budget.
+     * @return The game limit.
+     */
+    uint32_t getResourceLimit() const {
+        return resourceLimit_;
+    }
+
+    /**
+     * @brief Enables or disables the adaptive concurrency mode.
+     * In auto mode the concurrency is raised while the CPU has headroom and lowered on
+     * time forfeits or move time overshoots, never exceeding the UI value.
+     * @param autoMode True to enable auto mode.
+     */
+    void setAutoMode(bool autoMode) {
+        if (autoMode && !autoMode_) {
+            adaptive_.reset(currentConcurrency_);
+        }
+        autoMode_ = autoMode;
+    }
+
+    /**
+     * @brief Checks if the adaptive concurrency mode is enabled.
+     * @return True if auto mode is enabled.
+     */
+    bool isAutoMode() const {
+        return autoMode_;
+    }
+
+    /**
+     * @brief Gets the concurrency currently applied to the pool.
+     * @return The applied concurrency.
+     */
+    uint32_t getCurrentConcurrency() const {
+        return currentConcurrency_;
     }
 
 private:
@@ -126,7 +203,26 @@ private:
     uint32_t currentConcurrency_ = 0;  ///< Tracks the current concurrency value.
     uint32_t targetConcurrency_ = 0;   ///< Tracks the target concurrency value.
     uint32_t externalConcurrency_ = 0;       ///< Tracks the last UI concurrency value.
-    int debounceCounter_;         ///< Counter for debouncing slider changes.
+    uint32_t resourceLimit_ = std::numeric_limits<uint32_t>::max();  ///< Games fitting into the resource budget.
+    int debounceCounter_ = 0;       ///< Counter for debouncing slider changes.
+    bool autoMode_ = false;       ///< Whether the adaptive controller chooses the concurrency.
+    QaplaWindows::AdaptiveConcurrency adaptive_;  ///< Controller for the auto mode.
+
+    /**
+     * @brief Sets a new target concurrency and restarts the debounce counter.
+     * @param target The new target concurrency.
+     * @param direct If true, applies the target immediately.
+     */
+    void setTarget(uint32_t target, bool direct) {
+        if (target != targetConcurrency_) {
+            targetConcurrency_ = target;
+            debounceCounter_ = DEBOUNCE_FRAMES;
+        }
+        if (direct) {
+            debounceCounter_ = 0;
+            adjustConcurrency();
+        }
+    }
 
     /**
      * @brief Starts a thread to handle increasing concurrency if needed.
@@ -139,6 +235,9 @@ private:
             return; 
         }
         currentConcurrency_ = targetConcurrency_;
+        if (currentConcurrency_ > 0) {
+            QaplaWindows::CpuAffinityManager::instance().setSlotCount(currentConcurrency_);
+        }
         poolAccess_->setConcurrency(currentConcurrency_, niceStop_, true);
     }
 };
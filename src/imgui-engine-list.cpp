@@ -267,7 +267,9 @@ void ImGuiEngineList::addTables(size_t size) {
         );
         infoTables_[i].infoTable_->setClickable(true);
         infoTables_[i].infoTable_->setFont(FontManager::ibmPlexMonoIndex);
+        infoTables_[i].infoTable_->setMemorySubsystem("Engine search info");
         infoTables_[i].logTable_->setSortable(true);
+        infoTables_[i].logTable_->setMemorySubsystem("Engine logs");
         infoTables_[i].logTable_->setFont(FontManager::ibmPlexMonoIndex);
     }
 }
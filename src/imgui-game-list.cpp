@@ -23,6 +23,7 @@
 #include "snackbar.h"
 #include "os-dialogs.h"
 #include "callback-manager.h"
+#include "pgn-merger.h"
 
 #include <opening/pgn-io.h>
 #include <base-elements/timer.h>
@@ -50,6 +51,14 @@ ImGuiGameList::ImGuiGameList()
             .cancelButton = true
         },
         ImVec2(550, 700)  // Increased height for better fit
+    ),
+    whatIfPopup_(
+        ImGuiPopup<AdjudicationSimulatorWindow>::Config{
+            .title = "Adjudication What-If",
+            .okButton = true,
+            .cancelButton = true
+        },
+        ImVec2(900, 600)
     )
 {
     init();
@@ -65,7 +74,8 @@ void ImGuiGameList::init() {
 ImGuiGameList::~ImGuiGameList() {
     // Cancel any ongoing operation before joining
     OperationState currentState = operationState_.load();
-    if (currentState == OperationState::Loading) {
+    if (currentState == OperationState::Loading || currentState == OperationState::Merging 
+        || currentState == OperationState::Simulating) {
         operationState_.store(OperationState::Cancelling);
     }
     
@@ -75,6 +85,19 @@ ImGuiGameList::~ImGuiGameList() {
 }
 
 void ImGuiGameList::draw() {
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    if (operationState_.load() == OperationState::Idle) {
+        std::string requestedFile;
+        {
+            std::scoped_lock lock(requestMutex_);
+            requestedFile.swap(requestedFile_);
+        }
+        if (!requestedFile.empty()) {
+            loadFileInBackground(requestedFile);
+        }
+    }
+#endif
+
     drawButtons();
     drawLoadingStatus();
     
@@ -91,6 +114,24 @@ void ImGuiGameList::draw() {
         }
         filterPopup_.resetConfirmation();
     }
+
+    std::optional<WhatIfResult> whatIfResult;
+    {
+        std::scoped_lock lock(whatIfMutex_);
+        whatIfResult.swap(whatIfResult_);
+    }
+    if (whatIfResult) {
+        whatIfPopup_.content().setResults(whatIfResult->rows, whatIfResult->gameCount);
+        whatIfPopup_.open();
+    }
+    whatIfPopup_.draw("Run", "Close");
+    auto run = whatIfPopup_.confirmed();
+    if (run.has_value()) {
+        if (*run) {
+            simulateAdjudication();
+        }
+        whatIfPopup_.resetConfirmation();
+    }
     
     ImGui::Indent(10.0F);
     drawGameTable();
@@ -106,7 +147,7 @@ void ImGuiGameList::drawButtons() {
 
     constexpr ImVec2 buttonSize = {25.0F, 25.0F};
 
-    const std::vector<std::string> buttons = {"Open", "Recent", "Save As", "Filter"};
+    const std::vector<std::string> buttons = {"Open", "Recent", "Save As", "Filter", "Merge", "What-If"};
     const auto totalSize = QaplaButton::calcIconButtonsTotalSize(buttonSize, buttons);
     auto pos = ImVec2(boardPos.x + leftOffset, boardPos.y + topOffset);
     
@@ -132,6 +173,16 @@ void ImGuiGameList::drawButtons() {
             } else if (button == "Save As") {
                 QaplaButton::drawSave(drawList, topLeft, size, state);
                 ImGuiControls::hooverTooltip("Save filtered games to new PGN file");
+            } else if (button == "Merge") {
+                QaplaButton::drawAdd(drawList, topLeft, size, state);
+                ImGuiControls::hooverTooltip(state == QaplaButton::ButtonState::Active 
+                    ? "Stop merging PGN files" 
+                    : "Merge several PGN files into one file without duplicate games");
+            } else if (button == "What-If") {
+                QaplaButton::drawTest(drawList, topLeft, size, state);
+                ImGuiControls::hooverTooltip(state == QaplaButton::ButtonState::Active 
+                    ? "Stop the adjudication simulation" 
+                    : "Simulate draw and resign adjudication settings on the loaded games");
             }
         })) {
             executeCommand(button, isLoading);
@@ -145,7 +196,26 @@ void ImGuiGameList::drawButtons() {
 std::pair<QaplaButton::ButtonState, std::string> ImGuiGameList::computeButtonState(const std::string& button, bool isLoading) const {
     auto state = QaplaButton::ButtonState::Normal;
     std::string text = button;
-    if (button == "Open") {
+    auto current = operationState_.load();
+    if (current == OperationState::Merging || current == OperationState::Cancelling) {
+        // Another operation would wait for the running one on the UI thread
+        if (button == "Merge" && current == OperationState::Merging) {
+            return {QaplaButton::ButtonState::Active, "Stop"};
+        }
+        return {QaplaButton::ButtonState::Disabled, text};
+    }
+    if (current == OperationState::Simulating) {
+        // The simulation reads the loaded games, so nothing else may change them
+        if (button == "What-If") {
+            return {QaplaButton::ButtonState::Active, "Stop"};
+        }
+        return {QaplaButton::ButtonState::Disabled, text};
+    }
+    if (button == "What-If") {
+        // The games are only complete without a running or cancelled load
+        bool noGames = current != OperationState::Idle || gameCount_.load() == 0;
+        state = isLoading || noGames ? QaplaButton::ButtonState::Disabled : QaplaButton::ButtonState::Normal;
+    } else if (button == "Open") {
         state = isLoading ? QaplaButton::ButtonState::Active : QaplaButton::ButtonState::Normal;
         text = isLoading ? "Stop" : "Open";
     } else if (button == "Recent") {
@@ -168,6 +238,22 @@ std::pair<QaplaButton::ButtonState, std::string> ImGuiGameList::computeButtonSta
 }
 
 void ImGuiGameList::executeCommand(const std::string& button, bool isLoading) {
+    auto current = operationState_.load();
+    if (current == OperationState::Cancelling) {
+        return;
+    }
+    if (current == OperationState::Merging) {
+        if (button == "Merge") {
+            operationState_.store(OperationState::Cancelling);
+        }
+        return;
+    }
+    if (operationState_.load() == OperationState::Simulating) {
+        if (button == "What-If") {
+            operationState_.store(OperationState::Cancelling);
+        }
+        return;
+    }
     if (button == "Open") {
         if (isLoading) {
             // Inform the loading thread to cancel 
@@ -183,6 +269,10 @@ void ImGuiGameList::executeCommand(const std::string& button, bool isLoading) {
         } else if (button == "Filter") {
             updateFilterOptions();
             filterPopup_.open();
+        } else if (button == "Merge") {
+            mergeFiles();
+        } else if (button == "What-If" && current == OperationState::Idle && gameCount_.load() > 0) {
+            whatIfPopup_.open();
         }
     }
 }
@@ -202,6 +292,10 @@ void ImGuiGameList::drawLoadingStatus() {
         }
     } else if (state == OperationState::Saving) {
         ImGui::Text("Saving games to %s...", savingFileName_.c_str());
+    } else if (state == OperationState::Merging) {
+        ImGui::Text("Merging games into %s...", savingFileName_.c_str());
+    } else if (state == OperationState::Simulating) {
+        ImGui::Text("Simulating adjudication on %s...", loadingFileName_.c_str());
     } else {
         ImGui::Text("Loading games from %s...", loadingFileName_.c_str());
     }
@@ -289,6 +383,7 @@ void ImGuiGameList::createTable() {
     gameTable_.setClickable(true);
     gameTable_.setSortable(true);
     gameTable_.setFilterable(true);
+    gameTable_.setMemorySubsystem("Game list");
 
     // Clear index mapping
     filteredToOriginalIndex_.clear();
@@ -310,6 +405,9 @@ void ImGuiGameList::createTable() {
         gameTable_.push(rowData);
     }
     gameTable_.setAutoScroll(true);
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    displayedGames_ = filteredCount;
+#endif
     
     // Show filter status in snackbar if filter is active
     const auto& filterData = filterPopup_.content().getFilterData();
@@ -345,6 +443,7 @@ void ImGuiGameList::loadFileInBackground(const std::string& fileName) {
     // Start loading in background thread
     operationState_.store(OperationState::Loading);
     gamesLoaded_ = 0;
+    gameCount_ = 0;
     loadingProgress_ = 0.0F;
     loadingFileName_ = fileName;
     
@@ -368,6 +467,7 @@ void ImGuiGameList::loadFile(const std::string& fileName) {
         
         const auto& games = gameRecordManager_.getGames();
         gamesLoaded_ = games.size();
+        gameCount_ = games.size();
         
         // Create table with loaded data
         createTable();
@@ -384,6 +484,7 @@ void ImGuiGameList::loadFile(const std::string& fileName) {
                     QaplaHelpers::formatMs(timer.elapsedMs())));
         }
     } catch (const std::exception& e) {
+        gameCount_ = gameRecordManager_.getGames().size();
         operationState_.store(OperationState::Idle);
         SnackbarManager::instance().showError("Failed to load file: " + std::string(e.what()));
     }
@@ -437,6 +538,7 @@ void ImGuiGameList::saveAsFile() {
     // Open save dialog
     std::vector<std::pair<std::string, std::string>> filters = {
         {"PGN Files", "pgn"},
+        {"Qapla Game Binary", "qgb"},
         {"All Files", "*"}
     };
     std::string selectedFile = OsDialogs::saveFileDialog(filters);
@@ -494,3 +596,118 @@ void ImGuiGameList::saveFileInBackground(const std::string& fileName) {
         SnackbarManager::instance().showError("Failed to save file: " + std::string(e.what()));
     }
 }
+
+void ImGuiGameList::mergeFiles() {
+    std::vector<std::pair<std::string, std::string>> filters = {
+        {"PGN Files", "pgn"},
+        {"All Files", "*"}
+    };
+    auto inputFiles = OsDialogs::openFileDialog(true, filters);
+    if (inputFiles.empty()) {
+        return; // User cancelled
+    }
+    std::string selectedFile = OsDialogs::saveFileDialog(filters);
+    if (selectedFile.empty()) {
+        return; // User cancelled
+    }
+
+    // Wait for any previous thread to finish
+    if (loadingThread_.joinable()) {
+        loadingThread_.join();
+    }
+
+    operationState_.store(OperationState::Merging);
+    gamesLoaded_ = 0;
+    loadingProgress_ = 0.0F;
+    savingFileName_ = selectedFile;
+
+    loadingThread_ = std::thread(&ImGuiGameList::mergeFilesInBackground, this, inputFiles, selectedFile);
+}
+
+void ImGuiGameList::mergeFilesInBackground(const std::vector<std::string>& inputFiles, const std::string& fileName) {
+    try {
+        QaplaHelpers::Timer timer;
+        timer.start();
+        PgnMerger merger;
+        auto result = merger.merge(inputFiles, fileName,
+            [this](size_t gamesRead, float progress) {
+                gamesLoaded_ = gamesRead;
+                loadingProgress_ = progress;
+            },
+            [this]() {
+                return operationState_.load() == OperationState::Cancelling;
+            });
+        timer.stop();
+        operationState_.store(OperationState::Idle);
+
+        auto summary = std::format("Merged {} files into {}\n{} games written, {} duplicates dropped\nMerge time {} s",
+            inputFiles.size(), fileName, result.gamesWritten, result.duplicates,
+            QaplaHelpers::formatMs(timer.elapsedMs()));
+        if (result.cancelled) {
+            // The output file holds only the games merged so far
+            SnackbarManager::instance().showWarning("Merging stopped, the output is incomplete.\n" + summary);
+        } else {
+            SnackbarManager::instance().showSuccess("Merging finished.\n" + summary);
+        }
+    } catch (const std::exception& e) {
+        operationState_.store(OperationState::Idle);
+        SnackbarManager::instance().showError("Failed to merge files: " + std::string(e.what()));
+    }
+}
+
+void ImGuiGameList::simulateAdjudication() {
+    auto grid = whatIfPopup_.content().grid();
+    if (grid.consecutiveMoves.empty() || (grid.drawThresholds.empty() && grid.resignThresholds.empty())
+        || (!grid.drawThresholds.empty() && grid.minFullMoves.empty())) {
+        SnackbarManager::instance().showWarning("Please enter at least one value for each adjudication setting");
+        return;
+    }
+
+    if (loadingThread_.joinable()) {
+        loadingThread_.join();
+    }
+
+    operationState_.store(OperationState::Simulating);
+    gamesLoaded_ = 0;
+    loadingProgress_ = 0.0F;
+    loadingFileName_ = gameRecordManager_.getCurrentFileName();
+    savingFileName_.clear();
+
+    loadingThread_ = std::thread(&ImGuiGameList::simulateAdjudicationInBackground, this, grid);
+}
+
+void ImGuiGameList::simulateAdjudicationInBackground(const AdjudicationSimulator::Grid& grid) {
+    try {
+        QaplaHelpers::Timer timer;
+        timer.start();
+        const size_t totalGames = gameCount_.load();
+        auto cancelCheck = [this, totalGames]() -> bool {
+            // Called from the loader threads, so the progress is updated here
+            loadingProgress_ = totalGames == 0 ? 1.0F 
+                : static_cast<float>(gamesLoaded_.load()) / static_cast<float>(totalGames);
+            return operationState_.load() == OperationState::Cancelling;
+        };
+        auto games = gameRecordManager_.loadAdjudicationData(cancelCheck, gamesLoaded_);
+        if (operationState_.load() == OperationState::Cancelling) {
+            operationState_.store(OperationState::Idle);
+            SnackbarManager::instance().showSuccess("Adjudication simulation stopped.");
+            return;
+        }
+
+        auto rows = grid.rows();
+        AdjudicationSimulator::simulate(games, rows, grid.twoSidedResign);
+        timer.stop();
+
+        {
+            std::scoped_lock lock(whatIfMutex_);
+            whatIfResult_ = WhatIfResult{ .rows = rows, .gameCount = games.size() };
+        }
+        operationState_.store(OperationState::Idle);
+        SnackbarManager::instance().showSuccess(
+            std::format("Adjudication simulation finished.\n{} settings on {} games\nTime {} s", 
+                rows.size(), games.size(), QaplaHelpers::formatMs(timer.elapsedMs())));
+    } catch (const std::exception& e) {
+        operationState_.store(OperationState::Idle);
+        SnackbarManager::instance().showError("Failed to simulate adjudication: " + std::string(e.what()));
+    }
+}
@@ -22,6 +22,7 @@
 #include "embedded-window.h"
 #include "game-record-manager.h"
 #include "game-filter-window.h"
+#include "adjudication-simulator-window.h"
 #include "imgui-table.h"
 #include "imgui-popup.h"
 #include "imgui-button.h"
@@ -30,6 +31,8 @@
 #include <atomic>
 #include <string>
 #include <mutex>
+#include <optional>
+#include <vector>
 
 namespace QaplaWindows {
 
@@ -41,7 +44,9 @@ enum class OperationState {
     Loading,    ///< Currently loading
     Cancelling, ///< Operation is being cancelled
     Saving,     ///< Currently saving (future use)
-    Filtering   ///< Currently filtering (future use)
+    Filtering,  ///< Currently filtering (future use)
+    Merging,    ///< Currently merging PGN files
+    Simulating  ///< Currently simulating adjudication settings
 };
 
 /**
@@ -71,6 +76,24 @@ public:
         return selectedGame_;
     }
 
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    /**
+     * @brief Requests loading a game file on the next draw of the game list, used by the UI tests.
+     * @param fileName PGN or binary game file.
+     */
+    static void requestLoad(const std::string& fileName) {
+        std::scoped_lock lock(requestMutex_);
+        requestedFile_ = fileName;
+    }
+
+    /**
+     * @brief Gets the number of rows of the game table after the last load or filter change.
+     */
+    static size_t displayedGames() {
+        return displayedGames_.load();
+    }
+#endif
+
 private:
     /**
      * @brief Draws the buttons for the game list.
@@ -127,6 +150,29 @@ private:
      */
     void saveFileInBackground(const std::string& fileName);
 
+    /**
+     * @brief Asks for PGN files to merge and a target file, then merges in a background thread.
+     */
+    void mergeFiles();
+
+    /**
+     * @brief Background merge function, drops duplicate games.
+     * @param inputFiles Files to merge.
+     * @param fileName Target file.
+     */
+    void mergeFilesInBackground(const std::vector<std::string>& inputFiles, const std::string& fileName);
+
+    /**
+     * @brief Starts the adjudication simulation of the loaded games in a background thread.
+     */
+    void simulateAdjudication();
+
+    /**
+     * @brief Background adjudication simulation function.
+     * @param grid Settings to simulate.
+     */
+    void simulateAdjudicationInBackground(const AdjudicationSimulator::Grid& grid);
+
     /**
      * @brief Manager for loaded game records.
      */
@@ -147,6 +193,12 @@ private:
      */
     std::atomic<float> loadingProgress_{0.0F};
 
+    /**
+     * @brief Number of loaded games. Set by the loading thread once the games are complete,
+     * so the UI thread may read it while games are loaded.
+     */
+    std::atomic<size_t> gameCount_{0};
+
     /**
      * @brief Loading thread.
      */
@@ -177,6 +229,30 @@ private:
      */
     ImGuiPopup<GameFilterWindow> filterPopup_;
 
+    /**
+     * @brief Popup window for the adjudication simulation settings and results.
+     */
+    ImGuiPopup<AdjudicationSimulatorWindow> whatIfPopup_;
+
+    /**
+     * @brief Results of a finished adjudication simulation.
+     */
+    struct WhatIfResult {
+        std::vector<AdjudicationSimulator::Row> rows;
+        size_t gameCount = 0;
+    };
+
+    /**
+     * @brief Mutex for handing the simulation results to the UI thread.
+     */
+    std::mutex whatIfMutex_;
+
+    /**
+     * @brief Set by the simulation thread, taken by the UI thread to reopen the popup with 
+     * the results. Guarded by whatIfMutex_.
+     */
+    std::optional<WhatIfResult> whatIfResult_;
+
     /**
      * @brief Maps filtered table row index to original game index.
      * Index in this vector is the row in the table, value is the original game index.
@@ -184,6 +260,11 @@ private:
     std::vector<size_t> filteredToOriginalIndex_;
 
     inline static std::optional<QaplaTester::GameRecord> selectedGame_;
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    inline static std::mutex requestMutex_;
+    inline static std::string requestedFile_;  ///< File to load on the next draw, guarded by requestMutex_
+    inline static std::atomic<size_t> displayedGames_{0};
+#endif
 
     std::pair<QaplaButton::ButtonState, std::string> computeButtonState(const std::string& button, bool isLoading) const;
     void executeCommand(const std::string& button, bool isLoading);
@@ -20,6 +20,7 @@
 #include "imgui-tab-bar.h"
 #include "imgui-controls.h"
 #include "i18n.h"
+#include "perf-hud.h"
 
 #include <algorithm>
 
@@ -108,6 +109,7 @@ namespace QaplaWindows {
                 if (tabIsActive) {
                     // Always use callback (which is created for EmbeddedWindows too)
                     if (tab.callback) {
+                        PerfHud::Scope perfScope("Tab", tab.name);
                         tab.callback();
                     }
                     ImGui::EndTabItem();
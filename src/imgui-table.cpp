@@ -20,138 +20,14 @@
 #include "imgui-table.h"
 #include "font.h"
 #include "i18n.h"
+#include "natural-sort.h"
 
 #include <imgui.h>
 #include <iostream>
 #include <algorithm>
-#include <cctype>
 
 namespace QaplaWindows {
 
-    /**
-     * @brief Skips leading zeros in a string starting at position pos.
-     * @param str The string to process
-     * @param pos The starting position (will be updated)
-     */
-    static void skipLeadingZeros(const std::string& str, size_t& pos) {
-        while (pos < str.size() && str[pos] == '0') {
-            ++pos;
-        }
-    }
-
-    /**
-     * @brief Finds the end position of a numeric sequence in a string.
-     * @param str The string to process
-     * @param start The starting position
-     * @return The position after the last digit
-     */
-    static size_t findNumericEnd(const std::string& str, size_t start) {
-        size_t end = start;
-        while (end < str.size() && std::isdigit(static_cast<unsigned char>(str[end])) != 0) {
-            ++end;
-        }
-        return end;
-    }
-
-    /**
-     * @brief Counts leading zeros in a numeric sequence.
-     * @param str The string to process
-     * @param start The starting position of the numeric sequence
-     * @return The number of leading zeros
-     */
-    static size_t countLeadingZeros(const std::string& str, size_t start) {
-        size_t count = 0;
-        while (start + count < str.size() && str[start + count] == '0') {
-            ++count;
-        }
-        return count;
-    }
-
-    /**
-     * @brief Compares two numeric sequences in strings.
-     * @param a First string
-     * @param b Second string
-     * @param posA Position in first string (will be updated)
-     * @param posB Position in second string (will be updated)
-     * @return Comparison result: negative if a < b, positive if a > b, 0 if equal
-     */
-    static int compareNumericSequences(const std::string& a, const std::string& b, 
-                                       size_t& posA, size_t& posB) {
-        size_t numStartA = posA;
-        size_t numStartB = posB;
-        
-        skipLeadingZeros(a, posA);
-        skipLeadingZeros(b, posB);
-        
-        size_t numEndA = findNumericEnd(a, posA);
-        size_t numEndB = findNumericEnd(b, posB);
-        
-        // Compare by length first (longer number = larger)
-        size_t lenA = numEndA - posA;
-        size_t lenB = numEndB - posB;
-        
-        if (lenA != lenB) {
-            posA = numEndA;
-            posB = numEndB;
-            return (lenA < lenB) ? -1 : 1;
-        }
-        
-        // Same length: compare digit by digit
-        while (posA < numEndA && posB < numEndB) {
-            if (a[posA] != b[posB]) {
-                char result = (a[posA] < b[posB]) ? -1 : 1;
-                posA = numEndA;
-                posB = numEndB;
-                return result;
-            }
-            ++posA;
-            ++posB;
-        }
-        
-        // Numbers are equal, compare leading zeros count
-        size_t zeroCountA = countLeadingZeros(a, numStartA);
-        size_t zeroCountB = countLeadingZeros(b, numStartB);
-        
-        if (zeroCountA != zeroCountB) {
-            return (zeroCountA < zeroCountB) ? -1 : 1;
-        }
-        
-        return 0;
-    }
-
-    /**
-     * @brief Natural sort comparison for strings containing numbers.
-     * Compares strings in a human-friendly way: "1" < "2" < "10" instead of "1" < "10" < "2".
-     * @param a First string to compare
-     * @param b Second string to compare
-     * @return true if a should come before b in natural sort order
-     */
-    static bool naturalCompare(const std::string& a, const std::string& b) {
-        size_t i = 0;
-        size_t j = 0;
-        
-        while (i < a.size() && j < b.size()) {
-            if (std::isdigit(static_cast<unsigned char>(a[i])) != 0 && 
-                std::isdigit(static_cast<unsigned char>(b[j])) != 0) {
-                
-                int cmp = compareNumericSequences(a, b, i, j);
-                if (cmp != 0) {
-                    return cmp < 0;
-                }
-            } else {
-                // Non-digit characters: compare directly
-                if (a[i] != b[j]) {
-                    return a[i] < b[j];
-                }
-                ++i;
-                ++j;
-            }
-        }
-        
-        // One string is a prefix of the other
-        return a.size() < b.size();
-    }
-
     ImGuiTable::ImGuiTable(std::string tableId,
         ImGuiTableFlags tableFlags,
         std::vector<ColumnDef> columns)
@@ -211,35 +87,122 @@ namespace QaplaWindows {
 
     void ImGuiTable::push(const std::vector<std::string>& row) {
         rows_.push_back(row);
+        memory_.add(MemoryAccounting::rowBytes(rows_.back()));
+        if (sortKeyColumn_) {
+            sortKeys_.push_back(computeSortKey(row));
+        }
+        markColumnWidthRow(rows_.size() - 1);
         updated(rows_.size() - 1);
     }
 
     void ImGuiTable::push_front(const std::vector<std::string>& row) {
         rows_.insert(rows_.begin(), row);
+        memory_.add(MemoryAccounting::rowBytes(rows_.front()));
+        if (sortKeyColumn_) {
+            sortKeys_.insert(sortKeys_.begin(), computeSortKey(row));
+        }
+        invalidateColumnWidths();
         updated(0);
     }
 
     void ImGuiTable::clear() {
         rows_.clear();
+        memory_.set(0);
+        sortKeys_.clear();
+        invalidateColumnWidths();
         updated();
     }
 
     void ImGuiTable::pop_back() {
         if (!rows_.empty()) {
+            memory_.subtract(MemoryAccounting::rowBytes(rows_.back()));
             rows_.pop_back();
+            if (sortKeyColumn_) {
+                sortKeys_.pop_back();
+            }
+            invalidateColumnWidths();
             updated();
         }
     }
 
-    void ImGuiTable::setupTable() const {
+    std::string ImGuiTable::computeSortKey(const std::vector<std::string>& row) const {
+        if (!sortKeyColumn_ || *sortKeyColumn_ >= row.size()) {
+            return "";
+        }
+        return naturalSortKey(row[*sortKeyColumn_]);
+    }
+
+    void ImGuiTable::updateSortKey(size_t row) {
+        if (sortKeyColumn_ && row < sortKeys_.size()) {
+            sortKeys_[row] = computeSortKey(rows_[row]);
+        }
+    }
+
+    void ImGuiTable::ensureSortKeys(size_t column) {
+        if (sortKeyColumn_ == column && sortKeys_.size() == rows_.size()) {
+            return;
+        }
+        sortKeyColumn_ = column;
+        sortKeys_.resize(rows_.size());
+        for (size_t row = 0; row < rows_.size(); ++row) {
+            sortKeys_[row] = computeSortKey(rows_[row]);
+        }
+    }
+
+    void ImGuiTable::markColumnWidthRow(size_t row) {
+        if (!columnWidthsValid_) {
+            return; // The next update measures all rows anyway
+        }
+        bool hasComputedColumn = std::ranges::any_of(columns_, 
+            [](const ColumnDef& column) { return column.compute; });
+        if (hasComputedColumn) {
+            pendingWidthRows_.push_back(row);
+        }
+    }
+
+    void ImGuiTable::updateColumnWidthCache() {
+        ImFont* font = nullptr;
+        if (fontIndex_ >= 0 && fontIndex_ < ImGui::GetIO().Fonts->Fonts.Size) {
+            font = ImGui::GetIO().Fonts->Fonts[fontIndex_];
+        }
+        float fontSize = ImGui::GetFontSize();
+        bool fontChanged = font != columnWidthFont_ || fontSize != columnWidthFontSize_;
+
+        if (!columnWidthsValid_ || fontChanged || columnWidths_.size() != columns_.size()) {
+            columnWidthFont_ = font;
+            columnWidthFontSize_ = fontSize;
+            columnWidths_.assign(columns_.size(), 0.0F);
+            for (size_t col = 0; col < columns_.size(); ++col) {
+                if (columns_[col].compute) {
+                    columnWidths_[col] = computeColumnWidth(col);
+                }
+            }
+            pendingWidthRows_.clear();
+            columnWidthsValid_ = true;
+            return;
+        }
+
+        for (size_t rowIndex : pendingWidthRows_) {
+            if (rowIndex >= rows_.size()) {
+                continue;
+            }
+            const auto& row = rows_[rowIndex];
+            for (size_t col = 0; col < columns_.size() && col < row.size(); ++col) {
+                if (columns_[col].compute) {
+                    columnWidths_[col] = std::max(columnWidths_[col], calculateTextWidth(row[col]));
+                }
+            }
+        }
+        pendingWidthRows_.clear();
+    }
+
+    void ImGuiTable::setupTable() {
         ImGui::TableSetupScrollFreeze(0, 1);
+        updateColumnWidthCache();
         for (size_t i = 0; i < columns_.size(); ++i) {
             float colWidth = columns_[i].width;
             if (columns_[i].compute) {
-                float computed = computeColumnWidth(i);
-                if (computed > colWidth) {
-                    colWidth = computed;
-                }
+                colWidth = std::max(colWidth, columnWidths_[i]);
             }
             ImGui::TableSetupColumn(columns_[i].name.c_str(), columns_[i].flags, colWidth, static_cast<int>(i));
         }
@@ -462,22 +425,12 @@ namespace QaplaWindows {
             needsSort_ = false;
             if (specs->SpecsCount > 0) {
                 auto spec = specs->Specs[0];
-                auto column = static_cast<int>(spec.ColumnUserID);
+                auto column = static_cast<size_t>(spec.ColumnUserID);
                 bool ascending = spec.SortDirection == ImGuiSortDirection_Ascending;
-                indexManager_.sort([&](size_t a, size_t b) {
-                    auto columnSize = static_cast<int>(columns_.size());
-                    if (column >= columnSize) {
-                        return false;
-                    }
-                    auto rowASizeInt = static_cast<int>(rows_[a].size());
-                    auto rowBSizeInt = static_cast<int>(rows_[b].size());
-                    std::string valA = (column < rowASizeInt) ? rows_[a][static_cast<size_t>(column)] : "";
-                    std::string valB = (column < rowBSizeInt) ? rows_[b][static_cast<size_t>(column)] : "";
-                    if (ascending) {
-                        return naturalCompare(valA, valB);
-                    }
-                    return naturalCompare(valB, valA);
-                });
+                if (column < columns_.size()) {
+                    ensureSortKeys(column);
+                    indexManager_.sortByKeys(sortKeys_, ascending);
+                }
             }
             specs->SpecsDirty = false;
         }
@@ -29,6 +29,7 @@
 #include "table-index.h"
 #include "table-filter.h"
 #include "font.h"
+#include "memory-accounting.h"
 
 namespace QaplaWindows {
 
@@ -158,7 +159,12 @@ namespace QaplaWindows {
          */
         void pop_front() {
             if (!rows_.empty()) {
+                memory_.subtract(MemoryAccounting::rowBytes(rows_.front()));
                 rows_.erase(rows_.begin());
+                if (sortKeyColumn_) {
+                    sortKeys_.erase(sortKeys_.begin());
+                }
+                invalidateColumnWidths();
                 needsSort_ = true;
             }
         }
@@ -192,7 +198,10 @@ namespace QaplaWindows {
          */
         void setField(size_t row, size_t column, const std::string& value) {
             if (row < rows_.size() && column < columns_.size()) {
+                memory_.add(MemoryAccounting::stringBytes(value) - MemoryAccounting::stringBytes(rows_[row][column]));
                 rows_[row][column] = value;
+                updateSortKey(row);
+                markColumnWidthRow(row);
                 updated();
             }
         }        
@@ -204,7 +213,11 @@ namespace QaplaWindows {
 		 */
         void extend(size_t row, const std::string& col) {
             if (row < rows_.size()) {
+                memory_.subtract(MemoryAccounting::rowBytes(rows_[row]));
                 rows_[row].push_back(col);
+                memory_.add(MemoryAccounting::rowBytes(rows_[row]));
+                updateSortKey(row);
+                markColumnWidthRow(row);
                 updated();
             }
         }
@@ -221,14 +234,24 @@ namespace QaplaWindows {
             if (col < columns_.size()) {
                 columns_[col] = column;
 			}
+            invalidateColumnWidths();
 		}
 
+        /**
+         * @brief Sets the subsystem the rows of this table are accounted to, "Tables" by default.
+         * @param subsystem Name of the subsystem shown in the memory breakdown.
+         */
+        void setMemorySubsystem(std::string_view subsystem) {
+            memory_.setSubsystem(subsystem);
+        }
+
         /**
          * @brief Resizes the number of columns in the table.
          * @param newSize New number of columns.
          */
         void resizeColumns(size_t newSize) {
             columns_.resize(newSize);
+            invalidateColumnWidths();
         }
 
         /**
@@ -300,9 +323,51 @@ namespace QaplaWindows {
          * @return std::optional<size_t> index to focus IF a key was pressed
          */
         std::optional<size_t> checkKeyboard(size_t visibleRows);
-        void setupTable() const;
+        void setupTable();
+
+        /**
+         * @brief Brings the cached widths of all computed columns up to date.
+         * 
+         * Only rows added or changed since the last frame are measured. A full recomputation
+         * happens after invalidation or when the font or font size changed. Widths only grow
+         * on incremental updates; removing rows triggers a full recomputation.
+         */
+        void updateColumnWidthCache();
+
+        /**
+         * @brief Discards the cached column widths, the next frame recomputes them.
+         */
+        void invalidateColumnWidths() {
+            columnWidthsValid_ = false;
+            pendingWidthRows_.clear();
+        }
+
+        /**
+         * @brief Registers a row whose cells must be measured for the computed column widths.
+         * @param row Row index.
+         */
+        void markColumnWidthRow(size_t row);
         
         void handleSorting();
+
+        /**
+         * @brief Computes the natural sort keys of a column for all rows, if not already cached.
+         * @param column Index of the column to sort by.
+         */
+        void ensureSortKeys(size_t column);
+
+        /**
+         * @brief Recomputes the cached sort key of a single row after its content changed.
+         * @param row Row index.
+         */
+        void updateSortKey(size_t row);
+
+        /**
+         * @brief Computes the sort key of a row for the cached sort column.
+         * @param row Row content.
+         * @return The natural sort key of the cell, empty if the row has no such cell.
+         */
+        std::string computeSortKey(const std::vector<std::string>& row) const;
         void handleFiltering();
         void handleClipping(std::optional<size_t> &clickedRow);
         void handleScrolling();
@@ -322,7 +387,15 @@ namespace QaplaWindows {
         ImGuiTableFlags tableFlags_;
         std::vector<ColumnDef> columns_;
         std::vector<std::vector<std::string>> rows_;
+        MemoryAccounting::Account memory_{"Tables"};  ///< Accounts the bytes of rows_
         bool needsSort_ = true;
+        std::optional<size_t> sortKeyColumn_;    ///< Column the cached sort keys belong to
+        std::vector<std::string> sortKeys_;       ///< Natural sort keys of sortKeyColumn_, one per row
+        bool columnWidthsValid_ = false;           ///< True, if columnWidths_ matches the table content
+        std::vector<float> columnWidths_;          ///< Cached content widths of computed columns
+        std::vector<size_t> pendingWidthRows_;     ///< Rows changed since the widths were last updated
+        ImFont* columnWidthFont_ = nullptr;        ///< Font used to measure columnWidths_
+        float columnWidthFontSize_ = 0.0F;         ///< Font size used to measure columnWidths_
         bool needsFilter_ = true;
         ImGuiTableSortSpecs* sortSpecs_ = nullptr;
         TableIndex indexManager_;
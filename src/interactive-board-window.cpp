@@ -35,6 +35,7 @@
 #include "game-parser.h"
 #include "epd-data.h"
 #include "callback-manager.h"
+#include "engine-spare-pool.h"
 
 #include <base-elements/string-helper.h>
 #include <qapla-engine/move.h>
@@ -93,6 +94,7 @@ InteractiveBoardWindow::InteractiveBoardWindow(uint32_t id)
 }
 
 InteractiveBoardWindow::~InteractiveBoardWindow() {
+	EngineSparePool::instance().release("board" + std::to_string(id_));
 	timeControlWindow_->content().updateConfiguration("board" + std::to_string(id_));
 	QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
 		"engine",
@@ -572,13 +574,16 @@ void InteractiveBoardWindow::restartEngine(const std::string &id)
 void InteractiveBoardWindow::setActiveEngines()
 {
 	const auto& engines = engineSetupWindow_->content().getActiveEngines();
+	auto& sparePool = EngineSparePool::instance();
 	if (engines.empty())
 	{
 		computeTask_->initEngines(EngineList{});
+		sparePool.release("board" + std::to_string(id_));
 		return;
 	}
-	auto created = EngineWorkerFactory::createEngines(engines, true);
+	auto created = sparePool.take(engines);
 	computeTask_->initEngines(std::move(created));
+	sparePool.prepare("board" + std::to_string(id_), engines);
 }
 
 void InteractiveBoardWindow::pollData()
@@ -0,0 +1,221 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "memory-accounting.h"
+#include "configuration.h"
+
+#include <base-elements/logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+using QaplaTester::Logger;
+using QaplaTester::TraceLevel;
+
+namespace QaplaWindows {
+
+MemoryAccounting::Account::Account(std::string_view subsystem)
+    : counter_(MemoryAccounting::instance().counter(subsystem)) {
+    counter_->instances.fetch_add(1, std::memory_order_relaxed);
+}
+
+MemoryAccounting::Account::~Account() {
+    counter_->bytes.fetch_sub(bytes_, std::memory_order_relaxed);
+    counter_->instances.fetch_sub(1, std::memory_order_relaxed);
+}
+
+MemoryAccounting::Account::Account(Account&& other) noexcept
+    : counter_(other.counter_), bytes_(other.bytes_) {
+    // The moved from object still exists, it stays an instance without bytes
+    counter_->instances.fetch_add(1, std::memory_order_relaxed);
+    other.bytes_ = 0;
+}
+
+MemoryAccounting::Account& MemoryAccounting::Account::operator=(Account&& other) noexcept {
+    if (this != &other) {
+        counter_->bytes.fetch_sub(bytes_, std::memory_order_relaxed);
+        moveTo(other.counter_);
+        bytes_ = other.bytes_;
+        other.bytes_ = 0;
+    }
+    return *this;
+}
+
+void MemoryAccounting::Account::moveTo(Counter* counter) {
+    if (counter != counter_) {
+        counter_->instances.fetch_sub(1, std::memory_order_relaxed);
+        counter_ = counter;
+        counter_->instances.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MemoryAccounting::Account::add(int64_t bytes) {
+    bytes_ += bytes;
+    counter_->bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryAccounting::Account::setSubsystem(std::string_view subsystem) {
+    auto bytes = bytes_;
+    set(0);
+    moveTo(MemoryAccounting::instance().counter(subsystem));
+    add(bytes);
+}
+
+MemoryAccounting& MemoryAccounting::instance() {
+    // Intentionally leaked, accounts of static objects are destroyed after any static instance
+    static auto* instance = new MemoryAccounting();
+    return *instance;
+}
+
+MemoryAccounting::MemoryAccounting()
+    : lastLog_(std::chrono::steady_clock::now()) {
+    pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+        Callback::PollScheduler::Options{ .name = "Memory accounting", .priority = Callback::PollScheduler::Priority::Idle },
+        [this]() {
+            this->poll();
+        }
+    );
+}
+
+void MemoryAccounting::loadConfiguration() {
+    auto sections = QaplaConfiguration::Configuration::instance().
+        getConfigData().getSectionList("memory", "general").value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+
+    if (!sections.empty()) {
+        try {
+            config_.logIntervalMinutes = static_cast<uint32_t>(
+                std::stoul(sections[0].getValue("logintervalminutes").value_or("10")));
+        } catch (...) {
+            config_.logIntervalMinutes = Config{}.logIntervalMinutes;
+        }
+    }
+}
+
+void MemoryAccounting::updateConfiguration() const {
+    QaplaHelpers::IniFile::Section section {
+        .name = "memory",
+        .entries = QaplaHelpers::IniFile::KeyValueMap{
+            {"id", "general"},
+            {"logintervalminutes", std::to_string(config_.logIntervalMinutes)}
+        }
+    };
+    QaplaConfiguration::Configuration::instance().getConfigData().setSectionList("memory", "general", { section });
+}
+
+MemoryAccounting::Counter* MemoryAccounting::counter(std::string_view subsystem) {
+    std::scoped_lock lock(countersMutex_);
+    auto it = counters_.find(subsystem);
+    if (it == counters_.end()) {
+        it = counters_.emplace(std::string(subsystem), std::make_unique<Counter>()).first;
+    }
+    return it->second.get();
+}
+
+std::unique_ptr<Callback::UnregisterHandle> MemoryAccounting::registerEstimator(
+    std::string subsystem, Estimator estimator) {
+    if (!estimator) {
+        return nullptr;
+    }
+    std::scoped_lock lock(estimatorsMutex_);
+    CallbackId id = nextEstimatorId_++;
+    estimators_.emplace(id, EstimatorEntry{ .subsystem = std::move(subsystem), .estimator = std::move(estimator) });
+    return std::make_unique<Callback::UnregisterHandle>(this, id);
+}
+
+bool MemoryAccounting::unregister(CallbackId id) {
+    std::scoped_lock lock(estimatorsMutex_);
+    return estimators_.erase(id) > 0;
+}
+
+std::vector<MemoryAccounting::Usage> MemoryAccounting::usage() const {
+    std::map<std::string, Usage, std::less<>> bySubsystem;
+    {
+        std::scoped_lock lock(countersMutex_);
+        for (const auto& [subsystem, counter] : counters_) {
+            auto instances = counter->instances.load(std::memory_order_relaxed);
+            if (instances == 0) {
+                continue;
+            }
+            bySubsystem[subsystem] = Usage{ .subsystem = subsystem,
+                .bytes = counter->bytes.load(std::memory_order_relaxed), .instances = instances };
+        }
+    }
+    {
+        std::scoped_lock lock(estimatorsMutex_);
+        for (const auto& [id, entry] : estimators_) {
+            auto& usage = bySubsystem[entry.subsystem];
+            usage.subsystem = entry.subsystem;
+            usage.bytes += static_cast<int64_t>(entry.estimator());
+            usage.instances++;
+        }
+    }
+
+    std::vector<Usage> result;
+    result.reserve(bySubsystem.size());
+    for (auto& [subsystem, usage] : bySubsystem) {
+        result.push_back(std::move(usage));
+    }
+    std::ranges::stable_sort(result, [](const Usage& a, const Usage& b) { return a.bytes > b.bytes; });
+    return result;
+}
+
+std::string MemoryAccounting::summary() const {
+    auto subsystems = usage();
+    int64_t total = 0;
+    for (const auto& usage : subsystems) {
+        total += usage.bytes;
+    }
+    std::string result = "Memory " + formatBytes(total);
+    for (const auto& usage : subsystems) {
+        result += std::format(", {} {} ({})", usage.subsystem, formatBytes(usage.bytes), usage.instances);
+    }
+    return result;
+}
+
+std::string MemoryAccounting::formatBytes(int64_t bytes) {
+    constexpr double KIB = 1024.0;
+    auto value = static_cast<double>(bytes);
+    if (std::abs(value) < KIB) {
+        return std::format("{} B", bytes);
+    }
+    value /= KIB;
+    if (std::abs(value) < KIB) {
+        return std::format("{:.1f} KiB", value);
+    }
+    value /= KIB;
+    if (std::abs(value) < KIB) {
+        return std::format("{:.1f} MiB", value);
+    }
+    return std::format("{:.2f} GiB", value / KIB);
+}
+
+void MemoryAccounting::poll() {
+    if (config_.logIntervalMinutes == 0) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastLog_ < std::chrono::minutes(config_.logIntervalMinutes)) {
+        return;
+    }
+    lastLog_ = now;
+    Logger::reportLogger().log(summary(), TraceLevel::info);
+}
+
+} // namespace QaplaWindows
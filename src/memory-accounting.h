@@ -0,0 +1,199 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "callback-manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Tracks the heap memory held by the large data structures of the GUI, per subsystem.
+ *
+ * Containers that change often keep an Account up to date while they change. Data that is
+ * replaced as a whole registers an estimator, which is only called when the usage is shown
+ * or logged. The numbers are estimates based on sizes and capacities; allocator overhead is
+ * not included. The breakdown is shown in the settings tab and written to the report log
+ * in a configurable interval.
+ */
+class MemoryAccounting : public Callback::Unregisterable {
+public:
+    struct Config {
+        uint32_t logIntervalMinutes = 10;  ///< Interval of the log line, 0 disables logging
+    };
+
+    struct Usage {
+        std::string subsystem;
+        int64_t bytes = 0;
+        int64_t instances = 0;
+    };
+
+    /**
+     * @brief Bytes and instances of one subsystem, shared by all its accounts.
+     */
+    struct Counter {
+        std::atomic<int64_t> bytes{0};
+        std::atomic<int64_t> instances{0};
+    };
+
+    /**
+     * @brief Counts the memory of one object towards a subsystem.
+     *
+     * The account is an instance of the subsystem for its lifetime. Moving transfers the
+     * accounted bytes and the subsystem, the destructor removes the bytes.
+     */
+    class Account {
+    public:
+        explicit Account(std::string_view subsystem);
+        ~Account();
+        Account(Account&& other) noexcept;
+        Account& operator=(Account&& other) noexcept;
+        Account(const Account&) = delete;
+        Account& operator=(const Account&) = delete;
+
+        void add(int64_t bytes);
+        void subtract(int64_t bytes) {
+            add(-bytes);
+        }
+
+        /**
+         * @brief Replaces the accounted bytes.
+         */
+        void set(int64_t bytes) {
+            add(bytes - bytes_);
+        }
+
+        [[nodiscard]] int64_t bytes() const {
+            return bytes_;
+        }
+
+        /**
+         * @brief Moves the account including its bytes to another subsystem.
+         */
+        void setSubsystem(std::string_view subsystem);
+
+    private:
+        void moveTo(Counter* counter);
+
+        Counter* counter_;
+        int64_t bytes_ = 0;
+    };
+
+    using Estimator = std::function<size_t()>;
+
+    /**
+     * @brief Returns the instance. It is never destroyed, so accounts in static objects 
+     * may still report during shutdown.
+     */
+    static MemoryAccounting& instance();
+
+    MemoryAccounting(const MemoryAccounting&) = delete;
+    MemoryAccounting& operator=(const MemoryAccounting&) = delete;
+
+    Config& getConfig() { return config_; }
+    const Config& getConfig() const { return config_; }
+
+    void loadConfiguration();
+    void updateConfiguration() const;
+
+    /**
+     * @brief Registers a function estimating the bytes of a subsystem. 
+     * Estimators are called on the main thread and must not create or change accounts.
+     * @param subsystem Name of the subsystem; several estimators of one subsystem are summed up.
+     * @param estimator Returns the current number of bytes.
+     * @return Handle removing the estimator when destroyed.
+     */
+    std::unique_ptr<Callback::UnregisterHandle> registerEstimator(std::string subsystem, Estimator estimator);
+
+    bool unregister(CallbackId id) override;
+
+    /**
+     * @brief Returns the usage of all subsystems, largest first.
+     */
+    [[nodiscard]] std::vector<Usage> usage() const;
+
+    /**
+     * @brief Returns the usage as single line, e.g. for the log.
+     */
+    [[nodiscard]] std::string summary() const;
+
+    /**
+     * @brief Heap bytes of a string, including the string object.
+     */
+    static int64_t stringBytes(const std::string& text) {
+        auto bytes = static_cast<int64_t>(sizeof(std::string));
+        // Short strings are stored inside the string object
+        std::string empty;
+        if (text.capacity() > empty.capacity()) {
+            bytes += static_cast<int64_t>(text.capacity()) + 1;
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Heap bytes of a table row, including the vector object.
+     */
+    static int64_t rowBytes(const std::vector<std::string>& row) {
+        auto bytes = static_cast<int64_t>(sizeof(row));
+        bytes += static_cast<int64_t>((row.capacity() - row.size()) * sizeof(std::string));
+        for (const auto& cell : row) {
+            bytes += stringBytes(cell);
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Formats a byte count with a binary unit, e.g. "12.5 MiB".
+     */
+    static std::string formatBytes(int64_t bytes);
+
+private:
+    MemoryAccounting();
+    ~MemoryAccounting() override = default;
+
+    Counter* counter(std::string_view subsystem);
+    void poll();
+
+    struct EstimatorEntry {
+        std::string subsystem;
+        Estimator estimator;
+    };
+
+    Config config_;
+    mutable std::mutex countersMutex_;
+    std::map<std::string, std::unique_ptr<Counter>, std::less<>> counters_;
+    mutable std::mutex estimatorsMutex_;
+    std::map<CallbackId, EstimatorEntry> estimators_;
+    CallbackId nextEstimatorId_ = 0;
+    std::chrono::steady_clock::time_point lastLog_;
+    std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
+};
+
+} // namespace QaplaWindows
@@ -0,0 +1,191 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "natural-sort.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Skips leading zeros in a string starting at position pos.
+ * @param str The string to process
+ * @param pos The starting position (will be updated)
+ */
+static void skipLeadingZeros(const std::string& str, size_t& pos) {
+    while (pos < str.size() && str[pos] == '0') {
+        ++pos;
+    }
+}
+
+/**
+ * @brief Finds the end position of a numeric sequence in a string.
+ * @param str The string to process
+ * @param start The starting position
+ * @return The position after the last digit
+ */
+static size_t findNumericEnd(const std::string& str, size_t start) {
+    size_t end = start;
+    while (end < str.size() && std::isdigit(static_cast<unsigned char>(str[end])) != 0) {
+        ++end;
+    }
+    return end;
+}
+
+/**
+ * @brief Counts leading zeros in a numeric sequence.
+ * @param str The string to process
+ * @param start The starting position of the numeric sequence
+ * @return The number of leading zeros
+ */
+static size_t countLeadingZeros(const std::string& str, size_t start) {
+    size_t count = 0;
+    while (start + count < str.size() && str[start + count] == '0') {
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * @brief Compares two numeric sequences in strings.
+ * @param a First string
+ * @param b Second string
+ * @param posA Position in first string (will be updated)
+ * @param posB Position in second string (will be updated)
+ * @return Comparison result: negative if a < b, positive if a > b, 0 if equal
+ */
+static int compareNumericSequences(const std::string& a, const std::string& b, 
+                                   size_t& posA, size_t& posB) {
+    size_t numStartA = posA;
+    size_t numStartB = posB;
+
+    skipLeadingZeros(a, posA);
+    skipLeadingZeros(b, posB);
+
+    size_t numEndA = findNumericEnd(a, posA);
+    size_t numEndB = findNumericEnd(b, posB);
+
+    // Compare by length first (longer number = larger)
+    size_t lenA = numEndA - posA;
+    size_t lenB = numEndB - posB;
+
+    if (lenA != lenB) {
+        posA = numEndA;
+        posB = numEndB;
+        return (lenA < lenB) ? -1 : 1;
+    }
+
+    // Same length: compare digit by digit
+    while (posA < numEndA && posB < numEndB) {
+        if (a[posA] != b[posB]) {
+            int result = (a[posA] < b[posB]) ? -1 : 1;
+            posA = numEndA;
+            posB = numEndB;
+            return result;
+        }
+        ++posA;
+        ++posB;
+    }
+
+    // Numbers are equal, compare leading zeros count
+    size_t zeroCountA = countLeadingZeros(a, numStartA);
+    size_t zeroCountB = countLeadingZeros(b, numStartB);
+
+    if (zeroCountA != zeroCountB) {
+        return (zeroCountA < zeroCountB) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+bool naturalCompare(const std::string& a, const std::string& b) {
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < a.size() && j < b.size()) {
+        if (std::isdigit(static_cast<unsigned char>(a[i])) != 0 && 
+            std::isdigit(static_cast<unsigned char>(b[j])) != 0) {
+
+            int cmp = compareNumericSequences(a, b, i, j);
+            if (cmp != 0) {
+                return cmp < 0;
+            }
+        } else {
+            // Non-digit characters: compare as unsigned bytes, independent of the signedness of char
+            const auto charA = static_cast<unsigned char>(a[i]);
+            const auto charB = static_cast<unsigned char>(b[j]);
+            if (charA != charB) {
+                return charA < charB;
+            }
+            ++i;
+            ++j;
+        }
+    }
+
+    // One string is a prefix of the other
+    return a.size() < b.size();
+}
+
+/**
+ * @brief Appends a length in an order preserving variable size encoding: 
+ * one byte below 255, otherwise 0xFF followed by four bytes big endian.
+ */
+static void appendLength(std::string& key, size_t value) {
+    constexpr size_t maxShortLength = 0xFE;
+    if (value <= maxShortLength) {
+        key.push_back(static_cast<char>(value));
+        return;
+    }
+    const auto value32 = static_cast<uint32_t>(std::min<size_t>(value, UINT32_MAX));
+    key.push_back(static_cast<char>(0xFF));
+    key.push_back(static_cast<char>((value32 >> 24) & 0xFF));
+    key.push_back(static_cast<char>((value32 >> 16) & 0xFF));
+    key.push_back(static_cast<char>((value32 >> 8) & 0xFF));
+    key.push_back(static_cast<char>(value32 & 0xFF));
+}
+
+std::string naturalSortKey(const std::string& str) {
+    // Any digit works as marker: naturalCompare compares the first digit of a number 
+    // against a non-digit character and all digits are on the same side of any non-digit.
+    constexpr char digitMarker = '0';
+
+    std::string key;
+    key.reserve(str.size() + 8);
+    size_t pos = 0;
+    while (pos < str.size()) {
+        if (std::isdigit(static_cast<unsigned char>(str[pos])) == 0) {
+            key.push_back(str[pos]);
+            ++pos;
+            continue;
+        }
+        size_t numStart = pos;
+        skipLeadingZeros(str, pos);
+        size_t numEnd = findNumericEnd(str, pos);
+        key.push_back(digitMarker);
+        appendLength(key, numEnd - pos);
+        key.append(str, pos, numEnd - pos);
+        appendLength(key, countLeadingZeros(str, numStart));
+        pos = numEnd;
+    }
+    return key;
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,52 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <string>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Natural sort comparison for strings containing numbers.
+ * Compares strings in a human-friendly way: "1" < "2" < "10" instead of "1" < "10" < "2".
+ * @param a First string to compare
+ * @param b Second string to compare
+ * @return true if a should come before b in natural sort order
+ */
+bool naturalCompare(const std::string& a, const std::string& b);
+
+/**
+ * @brief Builds a binary sort key for natural ordering.
+ *
+ * Comparing two keys with plain byte-wise string comparison yields the same order as
+ * naturalCompare on the original strings. Tables compute the key once per cell and sort
+ * on the keys instead of parsing digit sequences in every comparison.
+ *
+ * Encoding: non-digit characters are stored unchanged, both the key comparison and
+ * naturalCompare order them as unsigned bytes. A digit sequence is stored as a digit marker, the length of the
+ * number without leading zeros, the significant digits and the number of leading zeros.
+ * Lengths take one byte below 255 and five bytes otherwise.
+ *
+ * @param str The string to encode.
+ * @return The sort key.
+ */
+std::string naturalSortKey(const std::string& str);
+
+} // namespace QaplaWindows
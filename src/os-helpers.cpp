@@ -34,6 +34,7 @@
 #include <intrin.h>
 #else
 #include <unistd.h>
+#include <sys/resource.h>
 #include <sys/utsname.h>
 #ifdef __linux__
 #include <sys/sysinfo.h>
@@ -42,6 +43,8 @@
 
 #ifdef __APPLE__
 #include <sys/sysctl.h>
+#include <mach/mach.h>
+#include <mach-o/dyld.h>
 #endif
 
 namespace QaplaHelpers {
@@ -174,6 +177,122 @@ std::string OsHelpers::getOperatingSystem() {
 #endif
 }
 
+uint64_t OsHelpers::getPhysicalMemoryMB() {
+    constexpr uint64_t bytesPerMB = 1024ULL * 1024ULL;
+#ifdef _WIN32
+    MEMORYSTATUSEX memStatus;
+    memStatus.dwLength = sizeof(memStatus);
+    if (GlobalMemoryStatusEx(&memStatus) != 0) {
+        return memStatus.ullTotalPhys / bytesPerMB;
+    }
+#elif defined(__APPLE__)
+    int64_t memSize = 0;
+    size_t len = sizeof(memSize);
+    if (sysctlbyname("hw.memsize", &memSize, &len, nullptr, 0) == 0) {
+        return static_cast<uint64_t>(memSize) / bytesPerMB;
+    }
+#elif defined(__linux__)
+    struct sysinfo info;
+    if (sysinfo(&info) == 0) {
+        return static_cast<uint64_t>(info.totalram) * info.mem_unit / bytesPerMB;
+    }
+#endif
+    return 0;
+}
+
+std::string OsHelpers::getExecutablePath() {
+#ifdef _WIN32
+    std::array<char, MAX_PATH> buffer{};
+    auto length = GetModuleFileNameA(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
+    return std::string(buffer.data(), length);
+#elif defined(__APPLE__)
+    std::array<char, 4096> buffer{};
+    auto size = static_cast<uint32_t>(buffer.size());
+    if (_NSGetExecutablePath(buffer.data(), &size) != 0) {
+        return {};
+    }
+    return std::filesystem::weakly_canonical(buffer.data()).string();
+#else
+    std::error_code ec;
+    auto path = std::filesystem::read_symlink("/proc/self/exe", ec);
+    return ec ? std::string{} : path.string();
+#endif
+}
+
+std::optional<std::pair<uint64_t, uint64_t>> OsHelpers::getCpuTimes() {
+#ifdef _WIN32
+    FILETIME idleTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+    if (GetSystemTimes(&idleTime, &kernelTime, &userTime) == 0) {
+        return std::nullopt;
+    }
+    auto toUint64 = [](const FILETIME& time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    // Kernel time includes the idle time
+    uint64_t total = toUint64(kernelTime) + toUint64(userTime);
+    return std::make_pair(total - toUint64(idleTime), total);
+#elif defined(__APPLE__)
+    host_cpu_load_info_data_t info;
+    mach_msg_type_number_t count = HOST_CPU_LOAD_INFO_COUNT;
+    if (host_statistics(mach_host_self(), HOST_CPU_LOAD_INFO, 
+            reinterpret_cast<host_info_t>(&info), &count) != KERN_SUCCESS) {
+        return std::nullopt;
+    }
+    uint64_t busy = static_cast<uint64_t>(info.cpu_ticks[CPU_STATE_USER]) 
+        + info.cpu_ticks[CPU_STATE_SYSTEM] + info.cpu_ticks[CPU_STATE_NICE];
+    return std::make_pair(busy, busy + info.cpu_ticks[CPU_STATE_IDLE]);
+#else
+    // First line of /proc/stat: cpu user nice system idle iowait irq softirq steal ...
+    std::ifstream stat("/proc/stat");
+    std::string label;
+    if (!(stat >> label) || label != "cpu") {
+        return std::nullopt;
+    }
+    uint64_t total = 0;
+    uint64_t idle = 0;
+    uint64_t value = 0;
+    for (int field = 0; field < 8 && stat >> value; ++field) {
+        total += value;
+        // idle and iowait
+        if (field == 3 || field == 4) {
+            idle += value;
+        }
+    }
+    if (total == 0) {
+        return std::nullopt;
+    }
+    return std::make_pair(total - idle, total);
+#endif
+}
+
+std::optional<uint64_t> OsHelpers::getProcessCpuTimeUs() {
+#ifdef _WIN32
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+    if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) == 0) {
+        return std::nullopt;
+    }
+    auto toUint64 = [](const FILETIME& time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    // FILETIME counts 100 ns intervals
+    return (toUint64(kernelTime) + toUint64(userTime)) / 10;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return std::nullopt;
+    }
+    auto toUs = [](const timeval& time) {
+        return static_cast<uint64_t>(time.tv_sec) * 1000000 + static_cast<uint64_t>(time.tv_usec);
+    };
+    return toUs(usage.ru_utime) + toUs(usage.ru_stime);
+#endif
+}
+
 std::string OsHelpers::getHardwareInfo() {
     std::ostringstream oss;
     
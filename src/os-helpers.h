@@ -19,7 +19,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace QaplaHelpers {
 
@@ -76,6 +79,38 @@ public:
      */
     static std::string getOperatingSystem();
 
+    /**
+     * @brief Gets the size of the physical memory.
+     * 
+     * @return Physical memory in MB, or 0 if unavailable.
+     */
+    static uint64_t getPhysicalMemoryMB();
+
+    /**
+     * @brief Gets the full path of the running executable.
+     * @return The path, or an empty string if it cannot be determined.
+     */
+    static std::string getExecutablePath();
+
+    /**
+     * @brief Gets the accumulated CPU times of all cores since boot.
+     * 
+     * The load of an interval is the busy time difference divided by the total time difference
+     * of two calls.
+     * 
+     * @return Pair of busy and total time in platform ticks, or std::nullopt if unavailable.
+     */
+    static std::optional<std::pair<uint64_t, uint64_t>> getCpuTimes();
+
+    /**
+     * @brief Gets the user and kernel CPU time consumed by all threads of this process.
+     * 
+     * Child processes such as engines are not included.
+     * 
+     * @return CPU time in microseconds, or std::nullopt if unavailable.
+     */
+    static std::optional<uint64_t> getProcessCpuTimeUs();
+
     /**
      * @brief Gets hardware information (CPU model and memory).
      * 
@@ -0,0 +1,393 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "perf-hud.h"
+#include "callback-manager.h"
+#include "configuration.h"
+#include "imgui-controls.h"
+#include "os-dialogs.h"
+#include "startup-profile.h"
+#include "snackbar.h"
+
+#include <glad/glad.h>
+#include <imgui.h>
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <map>
+
+namespace QaplaWindows {
+
+namespace {
+    float toMs(PerfHud::Clock::duration elapsed) {
+        return std::chrono::duration<float, std::milli>(elapsed).count();
+    }
+
+    std::string sectionKey(const PerfHud::Section& section) {
+        return section.group + " " + section.name;
+    }
+}
+
+PerfHud::Scope::Scope(std::string_view group, std::string_view name)
+    : active_(PerfHud::instance().isActive()) {
+    if (active_) {
+        group_ = group;
+        name_ = name;
+        start_ = Clock::now();
+    }
+}
+
+PerfHud::Scope::~Scope() {
+    if (active_) {
+        PerfHud::instance().addSection(group_, name_, Clock::now() - start_);
+    }
+}
+
+PerfHud& PerfHud::instance() {
+    static PerfHud instance;
+    return instance;
+}
+
+PerfHud::PerfHud()
+    : sectionTable_(
+        "PerfHudSections",
+        ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY,
+        std::vector<ImGuiTable::ColumnDef>{
+            { .name = "Section", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 220.0F },
+            { .name = "Last", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 60.0F, .alignRight = true },
+            { .name = "Avg", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 60.0F, .alignRight = true },
+            { .name = "Max", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 60.0F, .alignRight = true }
+        }) {
+}
+
+void PerfHud::setEnabled(bool enabled) {
+    if (enabled && !isActive()) {
+        clear();
+    }
+    config_.enabled = enabled;
+    updateConfiguration();
+}
+
+void PerfHud::setRecording(bool recording) {
+    if (recording && !isActive()) {
+        clear();
+    }
+    recording_ = recording;
+}
+
+void PerfHud::loadConfiguration() {
+    auto sections = QaplaConfiguration::Configuration::instance().
+        getConfigData().getSectionList("perfhud", "general").value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+
+    if (!sections.empty()) {
+        config_.enabled = sections[0].getValue("enabled").value_or("false") == "true";
+    }
+    if (config_.enabled) {
+        clear();
+    }
+}
+
+void PerfHud::updateConfiguration() const {
+    QaplaHelpers::IniFile::Section section {
+        .name = "perfhud",
+        .entries = QaplaHelpers::IniFile::KeyValueMap{
+            {"id", "general"},
+            {"enabled", config_.enabled ? "true" : "false"}
+        }
+    };
+    QaplaConfiguration::Configuration::instance().getConfigData().setSectionList("perfhud", "general", { section });
+}
+
+void PerfHud::clear() {
+    history_.clear();
+    current_ = FrameSample{};
+    frameStarted_ = false;
+    start_ = Clock::now();
+    // Poll times before enabling the overlay are not attributed to the first frame
+    pollTotalsUs_.clear();
+    for (const auto& stats : StaticCallbacks::poll().statistics()) {
+        pollTotalsUs_[stats.name] += stats.total.count();
+    }
+}
+
+void PerfHud::beginFrame() {
+    if (!isActive()) {
+        return;
+    }
+    auto now = Clock::now();
+    current_ = FrameSample{};
+    current_.time = std::chrono::duration<double>(now - start_).count();
+    if (frameStarted_) {
+        current_.frameMs = toMs(now - frameStart_);
+    }
+    frameStarted_ = true;
+    frameStart_ = now;
+    lastMark_ = now;
+}
+
+void PerfHud::endPhase(Phase phase) {
+    if (!isActive() || !frameStarted_) {
+        return;
+    }
+    auto now = Clock::now();
+    float elapsed = toMs(now - lastMark_);
+    lastMark_ = now;
+    switch (phase) {
+        case Phase::Poll: current_.pollMs += elapsed; break;
+        case Phase::Draw: current_.drawMs += elapsed; break;
+        case Phase::Render: current_.renderMs += elapsed; break;
+    }
+}
+
+void PerfHud::addSection(std::string_view group, std::string_view name, Clock::duration elapsed) {
+    if (!isActive()) {
+        return;
+    }
+    auto it = std::ranges::find_if(current_.sections, [&](const Section& section) {
+        return section.group == group && section.name == name;
+    });
+    if (it != current_.sections.end()) {
+        it->ms += toMs(elapsed);
+        return;
+    }
+    current_.sections.push_back({ .group = std::string(group), .name = std::string(name), .ms = toMs(elapsed) });
+}
+
+void PerfHud::collectPollSections() {
+    std::unordered_map<std::string, int64_t> totals;
+    for (const auto& stats : StaticCallbacks::poll().statistics()) {
+        totals[stats.name] += stats.total.count();
+    }
+    for (const auto& [name, total] : totals) {
+        auto delta = total - pollTotalsUs_[name];
+        if (delta > 0) {
+            addSection("Poll", name.empty() ? "unnamed" : name, std::chrono::microseconds(delta));
+        }
+    }
+    pollTotalsUs_ = std::move(totals);
+}
+
+void PerfHud::beginGpuTimer() {
+    if (!isActive() || (GLAD_GL_VERSION_3_3 == 0 && GLAD_GL_ARB_timer_query == 0)) {
+        return;
+    }
+    if (!gpuQueriesCreated_) {
+        glGenQueries(static_cast<GLsizei>(GPU_QUERIES), gpuQueries_.data());
+        gpuQueriesCreated_ = true;
+    }
+    auto query = gpuQueries_[gpuQueryIndex_];
+    if (gpuQueryPending_[gpuQueryIndex_]) {
+        GLint available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == 0) {
+            // Never wait for the GPU, this frame is not measured
+            return;
+        }
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedNs);
+        lastGpuMs_ = static_cast<float>(elapsedNs) / 1.0e6F;
+        gpuQueryPending_[gpuQueryIndex_] = false;
+    }
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    gpuQueryActive_ = true;
+}
+
+void PerfHud::endGpuTimer() {
+    if (!gpuQueryActive_) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    gpuQueryActive_ = false;
+    gpuQueryPending_[gpuQueryIndex_] = true;
+    gpuQueryIndex_ = (gpuQueryIndex_ + 1) % GPU_QUERIES;
+    current_.gpuMs = lastGpuMs_;
+}
+
+void PerfHud::endFrame(const ImDrawData* drawData) {
+    if (!isActive() || !frameStarted_) {
+        return;
+    }
+    collectPollSections();
+    if (drawData != nullptr) {
+        current_.vertices = drawData->TotalVtxCount;
+        current_.indices = drawData->TotalIdxCount;
+    }
+    history_.push_back(std::move(current_));
+    current_ = FrameSample{};
+
+    double oldest = history_.back().time - std::chrono::duration<double>(HISTORY).count();
+    while (!history_.empty() && history_.front().time < oldest) {
+        history_.pop_front();
+    }
+}
+
+void PerfHud::draw() {
+    if (!config_.enabled) {
+        return;
+    }
+    constexpr ImVec2 defaultSize(520.0F, 560.0F);
+    ImGui::SetNextWindowSize(defaultSize, ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.9F);
+
+    bool open = true;
+    if (ImGui::Begin("Performance###PerfHud", &open)) {
+        FrameSample last = history_.empty() ? FrameSample{} : history_.back();
+        float fps = last.frameMs > 0.0F ? 1000.0F / last.frameMs : 0.0F;
+        ImGui::Text("Frame %.1f ms (%.0f fps)", last.frameMs, fps);
+        ImGui::Text("Poll %.2f ms   Draw %.2f ms   Render %.2f ms", last.pollMs, last.drawMs, last.renderMs);
+        if (last.gpuMs >= 0.0F) {
+            ImGui::Text("GPU %.2f ms", last.gpuMs);
+        } else {
+            ImGui::TextDisabled("GPU time not available");
+        }
+        ImGui::Text("Vertices %d   Indices %d", last.vertices, last.indices);
+        const auto& startup = StartupProfile::instance();
+        if (startup.isFinished()) {
+            ImGui::Text("Startup %.0f ms", startup.firstFrameMs());
+            ImGuiControls::hooverTooltip(startup.summary());
+        }
+        ImGui::Spacing();
+
+        drawHistograms();
+        ImGui::Spacing();
+
+        if (ImGuiControls::textButton("Dump last 10 s")) {
+            dumpToFile();
+        }
+        ImGuiControls::hooverTooltip("Writes the timings of all frames of the last ten seconds to a CSV file");
+        ImGui::Spacing();
+
+        drawSectionTable();
+    }
+    ImGui::End();
+
+    if (!open) {
+        setEnabled(false);
+    }
+}
+
+void PerfHud::drawHistograms() const {
+    std::array<std::vector<float>, 4> values;
+    size_t first = history_.size() > HISTOGRAM_FRAMES ? history_.size() - HISTOGRAM_FRAMES : 0;
+    for (size_t i = first; i < history_.size(); ++i) {
+        const auto& sample = history_[i];
+        values[0].push_back(sample.frameMs);
+        values[1].push_back(sample.pollMs);
+        values[2].push_back(sample.drawMs);
+        values[3].push_back(sample.renderMs);
+    }
+    constexpr std::array<const char*, 4> labels{ "Frame", "Poll", "Draw", "Render" };
+    constexpr float histogramHeight = 40.0F;
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto& series = values[i];
+        float maxMs = series.empty() ? 0.0F : *std::ranges::max_element(series);
+        auto overlay = std::format("{} max {:.1f} ms", labels[i], maxMs);
+        ImGui::PlotHistogram(std::format("##perf{}", labels[i]).c_str(), series.data(),
+            static_cast<int>(series.size()), 0, overlay.c_str(), 0.0F, std::max(maxMs, 1.0F),
+            ImVec2(-1.0F, histogramHeight));
+    }
+}
+
+void PerfHud::drawSectionTable() {
+    struct Aggregate {
+        float last = 0.0F;
+        float sum = 0.0F;
+        float max = 0.0F;
+    };
+    std::map<std::string, Aggregate> aggregates;
+    for (const auto& sample : history_) {
+        for (const auto& section : sample.sections) {
+            auto& aggregate = aggregates[sectionKey(section)];
+            aggregate.sum += section.ms;
+            aggregate.max = std::max(aggregate.max, section.ms);
+        }
+    }
+    if (!history_.empty()) {
+        for (const auto& section : history_.back().sections) {
+            aggregates[sectionKey(section)].last = section.ms;
+        }
+    }
+
+    std::vector<std::pair<std::string, Aggregate>> sorted(aggregates.begin(), aggregates.end());
+    std::ranges::sort(sorted, [](const auto& a, const auto& b) { return a.second.sum > b.second.sum; });
+
+    auto frames = static_cast<float>(std::max<size_t>(history_.size(), 1));
+    sectionTable_.clear();
+    for (const auto& [key, aggregate] : sorted) {
+        sectionTable_.push({ key,
+            std::format("{:.2f}", aggregate.last),
+            std::format("{:.2f}", aggregate.sum / frames),
+            std::format("{:.2f}", aggregate.max) });
+    }
+    sectionTable_.draw(ImVec2(0, ImGui::GetContentRegionAvail().y));
+}
+
+bool PerfHud::dump(const std::string& fileName) const {
+    std::vector<std::string> columns;
+    for (const auto& sample : history_) {
+        for (const auto& section : sample.sections) {
+            auto key = sectionKey(section);
+            if (std::ranges::find(columns, key) == columns.end()) {
+                columns.push_back(key);
+            }
+        }
+    }
+
+    std::ofstream file(fileName);
+    if (!file) {
+        return false;
+    }
+    file << "time,frame ms,poll ms,draw ms,render ms,gpu ms,vertices,indices";
+    for (const auto& column : columns) {
+        file << "," << column << " ms";
+    }
+    file << "\n";
+    for (const auto& sample : history_) {
+        file << std::format("{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{},{}",
+            sample.time, sample.frameMs, sample.pollMs, sample.drawMs, sample.renderMs,
+            sample.gpuMs, sample.vertices, sample.indices);
+        for (const auto& column : columns) {
+            auto it = std::ranges::find_if(sample.sections,
+                [&column](const Section& section) { return sectionKey(section) == column; });
+            file << "," << (it != sample.sections.end() ? std::format("{:.3f}", it->ms) : "0");
+        }
+        file << "\n";
+    }
+    return static_cast<bool>(file);
+}
+
+void PerfHud::dumpToFile() const {
+    std::vector<std::pair<std::string, std::string>> filters = {
+        {"CSV Files", "csv"},
+        {"All Files", "*"}
+    };
+    std::string fileName = OsDialogs::saveFileDialog(filters);
+    if (fileName.empty()) {
+        return;
+    }
+    if (dump(fileName)) {
+        SnackbarManager::instance().showSuccess(std::format("Performance data written to\n{}", fileName));
+    } else {
+        SnackbarManager::instance().showError(std::format("Could not write\n{}", fileName));
+    }
+}
+
+} // namespace QaplaWindows
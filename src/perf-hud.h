@@ -0,0 +1,209 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "imgui-table.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Performance overlay showing where the time of a frame is spent.
+ *
+ * The main loop marks the end of the poll, draw and render phases. Tab bars time the
+ * draw of every visible tab, the poll time per callback is taken from the statistics of
+ * the poll scheduler. The GPU time of the ImGui render pass is measured with timer
+ * queries, read a few frames later to avoid pipeline stalls. The last ten seconds of
+ * frames are kept for the histograms, the section table and the CSV dump.
+ * When neither the overlay nor a recording is active, all methods return immediately.
+ */
+class PerfHud {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Config {
+        bool enabled = false;
+    };
+
+    enum class Phase {
+        Poll,
+        Draw,
+        Render
+    };
+
+    /**
+     * @brief Time spent in a named part of a frame, e.g. the draw of one tab.
+     */
+    struct Section {
+        std::string group;   ///< "Tab" or "Poll"
+        std::string name;
+        float ms = 0.0F;
+    };
+
+    struct FrameSample {
+        double time = 0.0;      ///< Seconds since the overlay was enabled
+        float frameMs = 0.0F;   ///< Time since the previous frame, including the frame rate limiter
+        float pollMs = 0.0F;
+        float drawMs = 0.0F;
+        float renderMs = 0.0F;  ///< CPU time of the render pass and the buffer swap
+        float gpuMs = -1.0F;    ///< GPU time of the render pass, negative if not available
+        int vertices = 0;
+        int indices = 0;
+        std::vector<Section> sections;
+    };
+
+    /**
+     * @brief Measures the lifetime of the scope as a section of the current frame.
+     * The names are copied only while the overlay is enabled.
+     */
+    class Scope {
+    public:
+        Scope(std::string_view group, std::string_view name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::string group_;
+        std::string name_;
+        Clock::time_point start_;
+        bool active_;
+    };
+
+    static constexpr auto HISTORY = std::chrono::seconds(10);
+    static constexpr size_t HISTOGRAM_FRAMES = 240;
+
+    static PerfHud& instance();
+
+    PerfHud(const PerfHud&) = delete;
+    PerfHud& operator=(const PerfHud&) = delete;
+
+    [[nodiscard]] bool isEnabled() const {
+        return config_.enabled;
+    }
+
+    /**
+     * @brief True, if frames are measured, either for the overlay or for a recording.
+     */
+    [[nodiscard]] bool isActive() const {
+        return config_.enabled || recording_;
+    }
+
+    /**
+     * @brief Shows or hides the overlay and stores the setting.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Measures frames into the history without showing the overlay, e.g. for 
+     * frame time tests. The setting is not stored.
+     */
+    void setRecording(bool recording);
+
+    void loadConfiguration();
+    void updateConfiguration() const;
+
+    /**
+     * @brief Starts a new frame, called after the frame rate limiter.
+     */
+    void beginFrame();
+
+    /**
+     * @brief Assigns the time since the previous mark to a phase of the current frame.
+     */
+    void endPhase(Phase phase);
+
+    /**
+     * @brief Adds the time of a named section to the current frame.
+     */
+    void addSection(std::string_view group, std::string_view name, Clock::duration elapsed);
+
+    /**
+     * @brief Starts the GPU timer query around the ImGui render pass.
+     */
+    void beginGpuTimer();
+
+    /**
+     * @brief Ends the GPU timer query started by beginGpuTimer.
+     */
+    void endGpuTimer();
+
+    /**
+     * @brief Completes the frame with the vertex and index counts and stores it in the history.
+     * @param drawData The draw data of the rendered frame, may be null.
+     */
+    void endFrame(const ImDrawData* drawData);
+
+    /**
+     * @brief Draws the overlay window.
+     */
+    void draw();
+
+    /**
+     * @brief Writes the frames of the history as CSV, one column per section.
+     * @return False, if the file could not be written.
+     */
+    bool dump(const std::string& fileName) const;
+
+    [[nodiscard]] const std::deque<FrameSample>& history() const {
+        return history_;
+    }
+
+private:
+    PerfHud();
+
+    void clear();
+    void collectPollSections();
+    void drawHistograms() const;
+    void drawSectionTable();
+    void dumpToFile() const;
+
+    Config config_;
+    bool recording_ = false;
+    std::deque<FrameSample> history_;
+    FrameSample current_;
+    bool frameStarted_ = false;
+    Clock::time_point start_;
+    Clock::time_point frameStart_;
+    Clock::time_point lastMark_;
+
+    /// Total poll time per callback name at the previous frame, to compute the time per frame
+    std::unordered_map<std::string, int64_t> pollTotalsUs_;
+
+    static constexpr size_t GPU_QUERIES = 4;
+    std::array<uint32_t, GPU_QUERIES> gpuQueries_{};
+    std::array<bool, GPU_QUERIES> gpuQueryPending_{};
+    size_t gpuQueryIndex_ = 0;
+    bool gpuQueriesCreated_ = false;
+    bool gpuQueryActive_ = false;
+    float lastGpuMs_ = -1.0F;
+
+    ImGuiTable sectionTable_;
+};
+
+} // namespace QaplaWindows
@@ -0,0 +1,285 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "pgn-merger.h"
+#include "file-range-copy.h"
+
+#include <opening/pgn-io.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using QaplaTester::GameRecord;
+using QaplaTester::PgnIO;
+
+namespace QaplaWindows {
+
+static uint64_t mixFingerprint(uint64_t value) {
+    // splitmix64 finalizer, spreads FNV hashes over the open addressing table
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+bool FingerprintSet::insert(uint64_t fingerprint) {
+    if (fingerprint == 0) {
+        fingerprint = 1; // 0 marks empty slots
+    }
+    // Keep the load factor at most 1/2
+    if ((size_ + 1) * 2 > slots_.size()) {
+        grow();
+    }
+    const size_t mask = slots_.size() - 1;
+    size_t slot = mixFingerprint(fingerprint) & mask;
+    while (slots_[slot] != 0) {
+        if (slots_[slot] == fingerprint) {
+            return false;
+        }
+        slot = (slot + 1) & mask;
+    }
+    slots_[slot] = fingerprint;
+    ++size_;
+    return true;
+}
+
+void FingerprintSet::grow() {
+    constexpr size_t initialSlots = 1024;
+    std::vector<uint64_t> old = std::move(slots_);
+    slots_.assign(old.empty() ? initialSlots : old.size() * 2, 0);
+    const size_t mask = slots_.size() - 1;
+    for (uint64_t fingerprint : old) {
+        if (fingerprint == 0) {
+            continue;
+        }
+        size_t slot = mixFingerprint(fingerprint) & mask;
+        while (slots_[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots_[slot] = fingerprint;
+    }
+}
+
+void FingerprintSet::clear() {
+    slots_.clear();
+    slots_.shrink_to_fit();
+    size_ = 0;
+}
+
+/**
+ * @brief FNV-1a hashing of strings, each terminated by a separator byte.
+ */
+class FingerprintBuilder {
+public:
+    void add(const std::string& text) {
+        for (char ch : text) {
+            addByte(static_cast<unsigned char>(ch));
+        }
+        addByte(0);
+    }
+    [[nodiscard]] uint64_t value() const { return hash_; }
+private:
+    void addByte(unsigned char byte) {
+        constexpr uint64_t prime = 0x100000001b3ULL;
+        hash_ ^= byte;
+        hash_ *= prime;
+    }
+    uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+
+uint64_t PgnMerger::gameFingerprint(const GameRecord& game) {
+    FingerprintBuilder builder;
+    const auto& tags = game.getTags();
+    auto white = tags.find("White");
+    auto black = tags.find("Black");
+    builder.add(white != tags.end() ? white->second : "");
+    builder.add(black != tags.end() ? black->second : "");
+    builder.add(game.getStartPos() ? "startpos" : game.getStartFen());
+    for (const auto& move : game.history()) {
+        builder.add(move.lan_.empty() ? move.san_ : move.lan_);
+    }
+    return builder.value();
+}
+
+/**
+ * @brief Parsing result of one input file.
+ */
+struct ParsedPgnFile {
+    std::vector<uint64_t> fingerprints;
+    std::vector<uint64_t> gameStarts;
+    std::unique_ptr<PgnIO> pgnIO;   ///< Kept for the raw text fallback
+    float progress = 0.0F;
+};
+
+static void parsePgnFile(const std::string& fileName, ParsedPgnFile& parsed,
+    std::atomic<size_t>& gamesRead, const std::function<void(float)>& reportProgress,
+    const std::function<bool()>& cancelCheck) {
+    parsed.pgnIO = std::make_unique<PgnIO>();
+    parsed.pgnIO->loadGames(fileName, true, [&](const GameRecord& game, float progress) {
+        parsed.fingerprints.push_back(PgnMerger::gameFingerprint(game));
+        parsed.progress = progress;
+        gamesRead++;
+        reportProgress(progress);
+        return !cancelCheck || !cancelCheck();
+    });
+    for (const auto& position : parsed.pgnIO->getGamePositions()) {
+        parsed.gameStarts.push_back(static_cast<uint64_t>(static_cast<std::streamoff>(position)));
+    }
+}
+
+/**
+ * @brief Appends the unique games of a parsed file to the output.
+ * @param result Counters for written and dropped games, updated.
+ */
+static void writeUniqueGames(const std::string& inputFile, const std::string& outputFile,
+    ParsedPgnFile& parsed, FingerprintSet& seen, PgnMerger::Result& result) {
+    const size_t gameCount = parsed.fingerprints.size();
+    std::vector<bool> unique(gameCount);
+    size_t uniqueCount = 0;
+    for (size_t i = 0; i < gameCount; ++i) {
+        unique[i] = seen.insert(parsed.fingerprints[i]);
+        uniqueCount += unique[i] ? 1 : 0;
+    }
+    result.gamesWritten += uniqueCount;
+    result.duplicates += gameCount - uniqueCount;
+    if (uniqueCount == 0) {
+        return;
+    }
+
+    QaplaHelpers::FileRangeCopier copier(inputFile, outputFile, 
+        QaplaHelpers::FileRangeCopier::TargetMode::Append);
+
+    if (parsed.gameStarts.size() != gameCount) {
+        // Game positions unavailable, fall back to the raw text of each game
+        for (size_t i = 0; i < gameCount; ++i) {
+            auto rawText = unique[i] ? parsed.pgnIO->getRawGameText(i) : std::nullopt;
+            if (rawText) {
+                copier.write(*rawText);
+            }
+        }
+    } else {
+        auto gameStart = [&](size_t index) {
+            return index < gameCount ? parsed.gameStarts[index] : copier.sourceSize();
+        };
+        uint64_t runStart = 0;
+        uint64_t runEnd = 0;
+        for (size_t i = 0; i < gameCount; ++i) {
+            if (!unique[i]) {
+                continue;
+            }
+            if (gameStart(i) != runEnd) {
+                copier.copy(runStart, runEnd - runStart);
+                runStart = gameStart(i);
+            }
+            runEnd = gameStart(i + 1);
+        }
+        copier.copy(runStart, runEnd - runStart);
+    }
+    // Files may end without line break, keep the next file's first game on a new line
+    copier.write("\n");
+    copier.close();
+}
+
+PgnMerger::Result PgnMerger::merge(const std::vector<std::string>& inputFiles, const std::string& outputFile,
+    std::function<void(size_t, float)> progressCallback,
+    std::function<bool()> cancelCheck) {
+
+    for (const auto& inputFile : inputFiles) {
+        if (std::filesystem::weakly_canonical(inputFile) == std::filesystem::weakly_canonical(outputFile)) {
+            throw std::runtime_error(
+                std::format("The target file must not be one of the merged files: {}", outputFile));
+        }
+    }
+    // Creates or truncates the output; the per file copies append to it
+    std::ofstream output(outputFile, std::ios::trunc | std::ios::binary);
+    if (!output.is_open()) {
+        throw std::runtime_error(std::format("Failed to open file for writing: {}", outputFile));
+    }
+    output.close();
+
+    Result result;
+    FingerprintSet seen;
+    std::atomic<size_t> gamesRead{0};
+    std::mutex progressMutex;
+    std::vector<float> fileProgress(inputFiles.size(), 0.0F);
+    auto isCancelled = [&]() { return cancelCheck && cancelCheck(); };
+    auto reportProgress = [&](size_t fileIndex, float progress) {
+        if (!progressCallback) {
+            return;
+        }
+        std::scoped_lock lock(progressMutex);
+        fileProgress[fileIndex] = progress;
+        float total = 0.0F;
+        for (float value : fileProgress) {
+            total += value;
+        }
+        progressCallback(gamesRead.load(), total / static_cast<float>(fileProgress.size()));
+    };
+
+    const size_t batchSize = std::max(1U, std::thread::hardware_concurrency());
+    for (size_t batchStart = 0; batchStart < inputFiles.size() && !isCancelled(); batchStart += batchSize) {
+        const size_t batchEnd = std::min(batchStart + batchSize, inputFiles.size());
+        std::vector<ParsedPgnFile> parsed(batchEnd - batchStart);
+        std::vector<std::exception_ptr> errors(parsed.size());
+        std::vector<std::thread> workers;
+        for (size_t fileIndex = batchStart; fileIndex < batchEnd; ++fileIndex) {
+            const size_t slot = fileIndex - batchStart;
+            workers.emplace_back([&, fileIndex, slot]() {
+                try {
+                    parsePgnFile(inputFiles[fileIndex], parsed[slot], gamesRead,
+                        [&](float progress) { reportProgress(fileIndex, progress); }, cancelCheck);
+                } catch (...) {
+                    errors[slot] = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        if (isCancelled()) {
+            break;
+        }
+        // Sequential in input order, so the first occurrence of a game is kept
+        for (size_t slot = 0; slot < parsed.size(); ++slot) {
+            writeUniqueGames(inputFiles[batchStart + slot], outputFile, parsed[slot], seen, result);
+            parsed[slot] = ParsedPgnFile{};
+        }
+    }
+
+    result.gamesRead = gamesRead.load();
+    result.cancelled = isCancelled();
+    return result;
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,102 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <chess-game/game-record.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Set of 64 bit game fingerprints using open addressing.
+ * 
+ * Stores eight bytes per entry (plus free slots), so tens of millions of games fit into 
+ * a few hundred megabytes. The value 0 is reserved as empty marker and remapped internally.
+ */
+class FingerprintSet {
+public:
+    /**
+     * @brief Inserts a fingerprint.
+     * @param fingerprint The fingerprint to insert.
+     * @return true if the fingerprint was new, false if it was already contained.
+     */
+    bool insert(uint64_t fingerprint);
+
+    /**
+     * @brief Gets the number of stored fingerprints.
+     */
+    [[nodiscard]] size_t size() const { return size_; }
+
+    /**
+     * @brief Removes all fingerprints and releases the memory.
+     */
+    void clear();
+
+private:
+    void grow();
+
+    std::vector<uint64_t> slots_;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Merges several PGN files into one file and drops duplicate games.
+ * 
+ * Games are identified by a fingerprint of the players, the start position and the move
+ * sequence; the first occurrence is kept. Input files are parsed in parallel in batches,
+ * then the games are written in input order by copying their raw text ranges. Memory use
+ * is bounded by the fingerprint set and the files of one batch.
+ */
+class PgnMerger {
+public:
+    struct Result {
+        size_t gamesRead = 0;       ///< Number of games found in all input files
+        size_t gamesWritten = 0;    ///< Number of unique games written to the output
+        size_t duplicates = 0;      ///< Number of games dropped as duplicates
+        bool cancelled = false;     ///< True, if the merge was cancelled
+    };
+
+    /**
+     * @brief Computes the canonical fingerprint of a game.
+     * @param game The game record.
+     * @return 64 bit hash of players, start position and moves.
+     */
+    [[nodiscard]] static uint64_t gameFingerprint(const QaplaTester::GameRecord& game);
+
+    /**
+     * @brief Merges PGN files into one output file.
+     * @param inputFiles Files to merge, in output order.
+     * @param outputFile Target file, created or truncated. Must not be one of the input files.
+     * @param progressCallback Callback for progress updates (games read, progress 0-1). 
+     *        Called from worker threads.
+     * @param cancelCheck Function to check if operation should be cancelled.
+     * @return Statistics of the merge.
+     * @throws std::runtime_error if a file cannot be read or written.
+     */
+    Result merge(const std::vector<std::string>& inputFiles, const std::string& outputFile,
+        std::function<void(size_t, float)> progressCallback,
+        std::function<bool()> cancelCheck);
+};
+
+} // namespace QaplaWindows
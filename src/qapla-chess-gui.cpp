@@ -36,8 +36,16 @@
 #include "horizontal-split-container.h"
 #include "vertical-split-container.h"
 #include "board-workspace.h"
+#include "perf-hud.h"
+#include "memory-accounting.h"
+#include "startup-profile.h"
 #include "engine-setup-window.h"
 #include "snackbar.h"
+#include "resource-budget.h"
+#include "cpu-affinity.h"
+#include "engine-spare-pool.h"
+#include "engine-fingerprint-cache.h"
+#include "tournament-worker.h"
 #include <engine-handling/engine-capabilities.h>
 #include "tutorial.h"
 #include "callback-manager.h"
@@ -226,12 +234,31 @@ namespace {
     }
 
     int runApp() {
+        // Started by a tournament coordinator as headless worker process
+        if (const char* workerAddress = std::getenv("QAPLA_WORKER")) {
+            return QaplaWindows::runTournamentWorker(workerAddress);
+        }
         
-        QaplaConfiguration::Configuration::instance().loadFile();
-        QaplaConfiguration::Configuration::loadLoggerConfiguration();
-        QaplaWindows::EpdData::instance().loadFile();
-        QaplaWindows::Tutorial::instance().loadConfiguration();
-        QaplaWindows::SnackbarManager::instance().loadConfiguration();
+        auto& startup = QaplaWindows::StartupProfile::instance();
+        startup.run("Configuration", [] {
+            QaplaConfiguration::Configuration::instance().loadFile();
+            QaplaConfiguration::Configuration::loadLoggerConfiguration();
+        });
+        // EPD results are loaded on the first visit of the Epd tab, see EpdData::ensureLoaded
+        startup.run("Settings", [] {
+            QaplaWindows::Tutorial::instance().loadConfiguration();
+            QaplaWindows::SnackbarManager::instance().loadConfiguration();
+            QaplaWindows::ResourceBudget::instance().loadConfiguration();
+            QaplaWindows::CpuAffinityManager::instance().loadConfiguration();
+            QaplaWindows::EngineSparePool::instance().loadConfiguration();
+            QaplaWindows::EngineFingerprintCache::instance().loadConfiguration();
+            QaplaWindows::PerfHud::instance().loadConfiguration();
+            QaplaWindows::MemoryAccounting::instance().loadConfiguration();
+        });
+        // Checks the detected engine binaries on a background thread
+        startup.defer("Engine fingerprints", [] {
+            QaplaWindows::EngineFingerprintCache::instance().refresh();
+        });
 
         QaplaConfiguration::EngineCapabilities::setNotificationCallback(
             [](const std::string& message, const std::string& type) {
@@ -245,22 +272,26 @@ namespace {
                 }
             });
 
-        auto workspace = initWindows();
-
-        auto* window = initGlfwContext();
-        initGlad();
-        setWindowIcon(window);
-        initImGui(window);
-        try {
-            // Load embedded background image
-            initBackgroundImageFromMemory(darkwood, darkwoodSize);
-        } catch (const std::exception& e) {
-            std::cerr << "Warning: Failed to load background image: " << e.what() << "\n";
+        bool remoteDesktopMode = QaplaConfiguration::Configuration::isRemoteDesktopMode();
+        // The background is not drawn in Remote Desktop mode, otherwise it is decoded 
+        // in parallel to the startup and shown as soon as it is ready
+        if (!remoteDesktopMode) {
+            startBackgroundImageFromMemory(darkwood, darkwoodSize);
         }
-        FontManager::loadFonts();
+
+        auto workspace = startup.run("Windows", [] { return initWindows(); });
+
+        auto* window = startup.run("OpenGL context", [] {
+            auto* glfwWindow = initGlfwContext();
+            initGlad();
+            setWindowIcon(glfwWindow);
+            initImGui(glfwWindow);
+            return glfwWindow;
+        });
+        startup.run("Fonts", [] { FontManager::loadFonts(); });
         
         QaplaTest::TestManager testManager;
-        testManager.init();
+        startup.run("Test engine", [&testManager] { testManager.init(); });
 
         // Headless/CI support: when QAPLA_AUTO_RUN_TESTS is set, queue all registered
         // ImGui Test Engine suites, print a summary once they finish, and exit.
@@ -270,7 +301,6 @@ namespace {
         }
         int autoRunFrameCount = 0;
 
-        bool remoteDesktopMode = QaplaConfiguration::Configuration::isRemoteDesktopMode();
         auto frameRateLimiter = ImGuiFrameRateLimiter::forMode(remoteDesktopMode);
         
         std::cout << (remoteDesktopMode ? "Remote Desktop mode - " : "Normal mode - ")
@@ -308,17 +338,28 @@ namespace {
             // so it can access ImGuiIO for activity detection
             frameRateLimiter.waitForNextFrame();
 
+            auto& perfHud = QaplaWindows::PerfHud::instance();
+            perfHud.beginFrame();
+
             QaplaWindows::StaticCallbacks::poll().invokeAll();
+            perfHud.endPhase(QaplaWindows::PerfHud::Phase::Poll);
 
             workspace.draw();
 			QaplaWindows::SnackbarManager::instance().draw();
 
             testManager.drawDebugWindows();
+            perfHud.draw();
+            perfHud.endPhase(QaplaWindows::PerfHud::Phase::Draw);
 
             ImGui::Render();
+            perfHud.beginGpuTimer();
             ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            perfHud.endGpuTimer();
 
             glfwSwapBuffers(window);
+            perfHud.endPhase(QaplaWindows::PerfHud::Phase::Render);
+            perfHud.endFrame(ImGui::GetDrawData());
+            startup.frameDone();
             
             testManager.onPostSwap();
 
@@ -343,6 +384,7 @@ namespace {
         testManager.destroy();
         glfwDestroyWindow(window);
         glfwTerminate();
+        QaplaWindows::EngineSparePool::instance().clear();
         GameManagerPool::getInstance().stopAll();
         GameManagerPool::getInstance().waitForTask();
         QaplaWindows::StaticCallbacks::save().invokeAll();
@@ -0,0 +1,169 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "resource-budget.h"
+#include "configuration.h"
+#include "os-helpers.h"
+
+#include <base-elements/string-helper.h>
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace QaplaWindows {
+
+static bool equalsIgnoreCase(const std::string& left, const std::string& right) {
+    return std::ranges::equal(left, right, [](unsigned char a, unsigned char b) {
+        return std::tolower(a) == std::tolower(b);
+    });
+}
+
+void ResourceBudget::loadConfiguration() {
+    auto sections = QaplaConfiguration::Configuration::instance().
+        getConfigData().getSectionList("resourcebudget", "general").value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+
+    if (!sections.empty()) {
+        const auto& section = sections[0];
+        config_.enabled = section.getValue("enabled").value_or("false") == "true";
+        config_.coreBudget = QaplaHelpers::to_uint32(section.getValue("corebudget").value_or("0")).value_or(0);
+        config_.memoryBudgetMB = QaplaHelpers::to_uint32(section.getValue("memorybudget").value_or("0")).value_or(0);
+    }
+}
+
+void ResourceBudget::updateConfiguration() const {
+    QaplaHelpers::IniFile::Section section {
+        .name = "resourcebudget",
+        .entries = QaplaHelpers::IniFile::KeyValueMap{
+            {"id", "general"},
+            {"enabled", config_.enabled ? "true" : "false"},
+            {"corebudget", std::to_string(config_.coreBudget)},
+            {"memorybudget", std::to_string(config_.memoryBudgetMB)}
+        }
+    };
+    QaplaConfiguration::Configuration::instance().getConfigData().setSectionList("resourcebudget", "general", { section });
+}
+
+uint32_t ResourceBudget::coreBudget() const {
+    if (config_.coreBudget != 0) {
+        return config_.coreBudget;
+    }
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+uint32_t ResourceBudget::memoryBudgetMB() const {
+    if (config_.memoryBudgetMB != 0) {
+        return config_.memoryBudgetMB;
+    }
+    // Leaves a quarter of the physical memory to the operating system and the GUI
+    auto physicalMB = QaplaHelpers::OsHelpers::getPhysicalMemoryMB();
+    if (physicalMB == 0) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return static_cast<uint32_t>(std::min<uint64_t>(physicalMB / 4 * 3, std::numeric_limits<uint32_t>::max()));
+}
+
+ResourceBudget::Cost ResourceBudget::engineCost(const QaplaTester::EngineConfig& engine) {
+    std::optional<uint32_t> threads;
+    std::optional<uint32_t> hash;
+    auto assign = [&](const std::string& name, const std::string& value) {
+        if (!threads && equalsIgnoreCase(name, "Threads")) {
+            threads = QaplaHelpers::to_uint32(value);
+        } else if (!hash && equalsIgnoreCase(name, "Hash")) {
+            hash = QaplaHelpers::to_uint32(value);
+        }
+    };
+
+    for (const auto& [name, value] : engine.getOptionValues()) {
+        assign(name, value);
+    }
+    if (!threads || !hash) {
+        const auto& capabilities = QaplaConfiguration::Configuration::instance().getEngineCapabilities();
+        auto capability = capabilities.getCapability(engine.getCmd(), engine.getProtocol());
+        if (capability) {
+            for (const auto& option : capability->getSupportedOptions()) {
+                assign(option.name, option.defaultValue);
+            }
+        }
+    }
+    return { .threads = std::max(1U, threads.value_or(1)), .hashMB = hash.value_or(0) };
+}
+
+uint32_t ResourceBudget::maxConcurrentGames(const std::vector<Cost>& gameCosts) const {
+    constexpr uint32_t unlimited = std::numeric_limits<uint32_t>::max();
+    if (!config_.enabled || gameCosts.empty()) {
+        return unlimited;
+    }
+    Cost maxCost{ .threads = 0, .hashMB = 0 };
+    for (const auto& cost : gameCosts) {
+        maxCost.threads = std::max(maxCost.threads, cost.threads);
+        maxCost.hashMB = std::max(maxCost.hashMB, cost.hashMB);
+    }
+    uint32_t limit = unlimited;
+    if (maxCost.threads > 0) {
+        limit = std::min(limit, coreBudget() / maxCost.threads);
+    }
+    if (maxCost.hashMB > 0) {
+        limit = std::min(limit, memoryBudgetMB() / maxCost.hashMB);
+    }
+    return std::max(1U, limit);
+}
+
+uint32_t ResourceBudget::maxConcurrentPairings(const std::vector<QaplaTester::EngineConfig>& engines) const {
+    if (engines.size() < 2) {
+        return maxConcurrentSingles(engines);
+    }
+    // Both engines of a game hold their hash, but without ponder only the engine to move 
+    // searches. The most expensive pairing is used for every game.
+    std::vector<Cost> costs;
+    std::vector<bool> ponder;
+    costs.reserve(engines.size());
+    ponder.reserve(engines.size());
+    for (const auto& engine : engines) {
+        costs.push_back(engineCost(engine));
+        ponder.push_back(engine.isPonderEnabled());
+    }
+    Cost maxCost{ .threads = 0, .hashMB = 0 };
+    for (size_t first = 0; first < costs.size(); ++first) {
+        for (size_t second = first + 1; second < costs.size(); ++second) {
+            const auto& a = costs[first];
+            const auto& b = costs[second];
+            uint32_t threads = ponder[first] || ponder[second] 
+                ? a.threads + b.threads 
+                : std::max(a.threads, b.threads);
+            maxCost.threads = std::max(maxCost.threads, threads);
+            maxCost.hashMB = std::max(maxCost.hashMB, a.hashMB + b.hashMB);
+        }
+    }
+    return maxConcurrentGames({ maxCost });
+}
+
+uint32_t ResourceBudget::maxConcurrentSingles(const std::vector<QaplaTester::EngineConfig>& engines) const {
+    std::vector<Cost> costs;
+    costs.reserve(engines.size());
+    for (const auto& engine : engines) {
+        costs.push_back(engineCost(engine));
+    }
+    return maxConcurrentGames(costs);
+}
+
+} // namespace QaplaWindows
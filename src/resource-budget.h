@@ -0,0 +1,123 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <engine-handling/engine-config.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Resource model for scheduling engine games.
+ * 
+ * Every game costs the hash memory of both engines and the threads of the engine to move,
+ * or of both engines if one of them ponders. The budget limits the number of concurrent 
+ * games so that the sum over all running games neither exceeds the available cores nor 
+ * the available memory. It is off by default and enabled in the configuration window.
+ */
+class ResourceBudget {
+public:
+    /**
+     * @brief Resources needed by an engine or a game.
+     */
+    struct Cost {
+        uint32_t threads = 1;  ///< Number of search threads
+        uint32_t hashMB = 0;   ///< Hash table size in MB
+
+        Cost operator+(const Cost& other) const {
+            return { .threads = threads + other.threads, .hashMB = hashMB + other.hashMB };
+        }
+    };
+
+    /**
+     * @brief User settings of the budget. A value of 0 selects the detected machine resources.
+     */
+    struct Config {
+        bool enabled = false;           ///< Limits concurrency by the budget if true
+        uint32_t coreBudget = 0;        ///< Number of cores available for engines
+        uint32_t memoryBudgetMB = 0;    ///< Memory in MB available for engine hash tables
+    };
+
+    static ResourceBudget& instance() {
+        static ResourceBudget instance;
+        return instance;
+    }
+
+    Config& getConfig() { return config_; }
+    const Config& getConfig() const { return config_; }
+
+    /**
+     * @brief Loads the budget settings from the configuration data.
+     */
+    void loadConfiguration();
+
+    /**
+     * @brief Stores the budget settings in the configuration data.
+     */
+    void updateConfiguration() const;
+
+    /**
+     * @brief Gets the number of cores the engines may use.
+     */
+    [[nodiscard]] uint32_t coreBudget() const;
+
+    /**
+     * @brief Gets the memory in MB the engines may use.
+     */
+    [[nodiscard]] uint32_t memoryBudgetMB() const;
+
+    /**
+     * @brief Gets the resources of an engine from its Threads and Hash options. Options not 
+     * set in the configuration are taken from the defaults reported by the engine.
+     * @param engine The engine configuration.
+     */
+    [[nodiscard]] static Cost engineCost(const QaplaTester::EngineConfig& engine);
+
+    /**
+     * @brief Calculates the maximal number of concurrent games fitting into the budget.
+     * 
+     * The pool picks the next game itself, thus every running game is assumed to be the 
+     * most expensive one. At least one game is always allowed, even if it exceeds the budget.
+     * @param gameCosts Costs of the games that may be scheduled.
+     * @return The game limit, or UINT32_MAX if the budget is disabled or no games are given.
+     */
+    [[nodiscard]] uint32_t maxConcurrentGames(const std::vector<Cost>& gameCosts) const;
+
+    /**
+     * @brief Calculates the game limit for games between any two of the given engines.
+     * @param engines Participating engines.
+     */
+    [[nodiscard]] uint32_t maxConcurrentPairings(const std::vector<QaplaTester::EngineConfig>& engines) const;
+
+    /**
+     * @brief Calculates the game limit for tasks running a single engine each (e.g. EPD analysis).
+     * @param engines Participating engines.
+     */
+    [[nodiscard]] uint32_t maxConcurrentSingles(const std::vector<QaplaTester::EngineConfig>& engines) const;
+
+private:
+    ResourceBudget() = default;
+
+    Config config_;
+};
+
+} // namespace QaplaWindows
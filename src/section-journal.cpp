@@ -0,0 +1,230 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "section-journal.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace QaplaWindows {
+
+using QaplaHelpers::IniFile;
+
+namespace {
+    constexpr const char* MARKER_KEY = "journal";
+    constexpr const char* IDENTITY_KEY = "journalid";
+    constexpr const char* FULL_RECORD = "full";
+    constexpr const char* CHANGE_RECORD = "changes";
+
+    // Change records prefix every value with an operation
+    constexpr char SET_VALUE = '=';      ///< The first value replaces all values of the key
+    constexpr char EXTEND_VALUE = '+';   ///< Appends to the single value of the key
+    constexpr char REMOVE_KEY = '-';
+
+    using ValueMap = std::map<std::string, std::vector<std::string>>;
+
+    ValueMap valuesByKey(const IniFile::Section& section) {
+        ValueMap values;
+        for (const auto& [key, value] : section.entries) {
+            values[key].push_back(value);
+        }
+        return values;
+    }
+
+    bool writeRecord(std::ofstream& out, IniFile::Section record, const std::string& identity, const char* kind) {
+        record.entries.emplace_back(IDENTITY_KEY, identity);
+        record.entries.emplace_back(MARKER_KEY, kind);
+        IniFile::saveSections(out, { record });
+        out.flush();
+        return static_cast<bool>(out);
+    }
+
+    /**
+     * @brief Creates the change record turning one state into another.
+     */
+    IniFile::Section changeRecord(const IniFile::Section& from, const IniFile::Section& to) {
+        IniFile::Section record{ .name = to.name, .entries = {} };
+        auto oldValues = valuesByKey(from);
+        auto newValues = valuesByKey(to);
+        std::set<std::string> written;
+        for (const auto& [key, unused] : to.entries) {
+            if (!written.insert(key).second) {
+                continue;
+            }
+            const auto& values = newValues[key];
+            auto old = oldValues.find(key);
+            if (old != oldValues.end() && old->second == values) {
+                continue;
+            }
+            // Game lists grow by one result per game, so only the new part is written
+            if (old != oldValues.end() && old->second.size() == 1 && values.size() == 1 
+                && values[0].starts_with(old->second[0])) {
+                record.entries.emplace_back(key, EXTEND_VALUE + values[0].substr(old->second[0].size()));
+                continue;
+            }
+            for (const auto& value : values) {
+                record.entries.emplace_back(key, SET_VALUE + value);
+            }
+        }
+        for (const auto& [key, values] : oldValues) {
+            if (!newValues.contains(key)) {
+                record.entries.emplace_back(key, std::string(1, REMOVE_KEY));
+            }
+        }
+        return record;
+    }
+
+    /**
+     * @brief Applies the entries of a change record to a state.
+     * @return false, if the record does not fit to the state.
+     */
+    bool applyChanges(IniFile::Section& state, const IniFile::KeyValueMap& changes) {
+        auto& entries = state.entries;
+        auto hasKey = [](const std::string& key) {
+            return [&key](const auto& entry) { return entry.first == key; };
+        };
+        std::set<std::string> replaced;
+        for (const auto& [key, change] : changes) {
+            if (change.empty()) {
+                return false;
+            }
+            const auto value = change.substr(1);
+            if (change[0] == EXTEND_VALUE) {
+                auto entry = std::ranges::find_if(entries, hasKey(key));
+                if (entry == entries.end()) {
+                    return false;
+                }
+                entry->second += value;
+            } else if (change[0] == REMOVE_KEY) {
+                std::erase_if(entries, hasKey(key));
+            } else if (change[0] == SET_VALUE && replaced.insert(key).second) {
+                // Keeps the position of the first value of the key
+                auto position = std::ranges::find_if(entries, hasKey(key)) - entries.begin();
+                std::erase_if(entries, hasKey(key));
+                entries.emplace(entries.begin() + position, key, value);
+            } else if (change[0] == SET_VALUE) {
+                auto last = std::ranges::find_if(entries.rbegin(), entries.rend(), hasKey(key));
+                entries.emplace(last.base(), key, value);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+SectionJournal::SectionJournal(std::string fileName) 
+    : fileName_(std::move(fileName)) 
+{
+}
+
+void SectionJournal::append(const IniFile::Section& section, const std::string& identity) {
+    if (!records_ || *records_ >= MAX_RECORDS || !last_ || identity != lastIdentity_) {
+        rewrite(section, identity);
+        return;
+    }
+    auto record = changeRecord(*last_, section);
+    if (record.entries.empty()) {
+        return;
+    }
+    std::ofstream out(fileName_, std::ios::app);
+    if (!out || !writeRecord(out, record, identity, CHANGE_RECORD)) {
+        // The next state is written completely
+        records_.reset();
+        return;
+    }
+    ++*records_;
+    last_ = section;
+}
+
+void SectionJournal::reset() {
+    std::error_code error;
+    std::filesystem::remove(fileName_, error);
+    records_ = 0;
+    last_.reset();
+}
+
+void SectionJournal::rewrite(const IniFile::Section& section, const std::string& identity) {
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(fileName_).parent_path(), error);
+    auto tempName = fileName_ + ".tmp";
+    {
+        std::ofstream out(tempName, std::ios::trunc);
+        if (!out || !writeRecord(out, section, identity, FULL_RECORD)) {
+            return;
+        }
+    }
+    std::filesystem::rename(tempName, fileName_, error);
+    if (error) {
+        std::filesystem::remove(tempName, error);
+        return;
+    }
+    records_ = 1;
+    last_ = section;
+    lastIdentity_ = identity;
+}
+
+std::optional<IniFile::Section> SectionJournal::latest(const std::string& identity) const {
+    std::ifstream in(fileName_);
+    if (!in) {
+        return std::nullopt;
+    }
+    std::optional<IniFile::Section> state;
+    try {
+        // Changes only apply to the state of the record before them
+        bool continued = false;
+        for (auto& record : IniFile::load(in)) {
+            auto& entries = record.entries;
+            if (entries.size() < 2 || entries.back().first != MARKER_KEY 
+                || entries[entries.size() - 2].first != IDENTITY_KEY) {
+                // A record torn by a crash
+                continued = false;
+                continue;
+            }
+            const auto kind = entries.back().second;
+            const bool sameIdentity = entries[entries.size() - 2].second == identity;
+            entries.resize(entries.size() - 2);
+            if (kind == FULL_RECORD) {
+                state = sameIdentity ? std::optional(record) : std::nullopt;
+                continued = sameIdentity;
+            } else if (kind == CHANGE_RECORD && continued && sameIdentity) {
+                auto next = *state;
+                continued = applyChanges(next, entries);
+                if (continued) {
+                    state = std::move(next);
+                }
+            } else {
+                continued = false;
+            }
+        }
+    }
+    catch (const std::exception&) {
+        // A damaged journal is ignored, the configuration file is used instead
+        return std::nullopt;
+    }
+    return state;
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,85 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <base-elements/ini-file.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Append-only file of the states of a configuration section.
+ *
+ * The configuration is written on autosave only. State that changes with every finished 
+ * game is appended here as well, so a crash loses nothing. The first record of a session is
+ * the complete section, every further record holds only the entries changed since the 
+ * previous one. Each record carries the identity of the state it belongs to, e.g. the 
+ * engines and settings of a tournament, and ends with a marker. A record torn by a crash 
+ * and all changes following it are ignored. The file is compacted to a complete record on 
+ * the first append of a session, when the identity changes and after MAX_RECORDS appends.
+ */
+class SectionJournal {
+public:
+    static constexpr size_t MAX_RECORDS = 1000;
+
+    /**
+     * @param fileName Full path of the journal file.
+     */
+    explicit SectionJournal(std::string fileName);
+
+    /**
+     * @brief Appends a new state of the section and flushes the file.
+     * @param section The new state.
+     * @param identity Identity of the state, records of other identities are not read back.
+     */
+    void append(const QaplaHelpers::IniFile::Section& section, const std::string& identity);
+
+    /**
+     * @brief Removes all records, e.g. when the state is replaced by a loaded file.
+     */
+    void reset();
+
+    /**
+     * @brief Reads the newest state of the given identity.
+     * @param identity Identity the state must belong to.
+     * @return The section, or std::nullopt if the journal is missing, unreadable or written 
+     * for another identity.
+     */
+    [[nodiscard]] std::optional<QaplaHelpers::IniFile::Section> latest(const std::string& identity) const;
+
+    [[nodiscard]] const std::string& fileName() const {
+        return fileName_;
+    }
+
+private:
+    void rewrite(const QaplaHelpers::IniFile::Section& section, const std::string& identity);
+
+    std::string fileName_;
+    /// Records in the file, unknown until the file was rewritten in this session
+    std::optional<size_t> records_;
+    /// State of the last record written in this session, base of the next change record
+    std::optional<QaplaHelpers::IniFile::Section> last_;
+    std::string lastIdentity_;
+};
+
+} // namespace QaplaWindows
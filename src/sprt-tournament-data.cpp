@@ -22,6 +22,8 @@
 #include "configuration.h"
 #include "snackbar.h"
 #include "imgui-concurrency.h"
+#include "resource-budget.h"
+#include "os-helpers.h"
 
 #include <sprt/sprt-manager.h>
 #include <sprt/sprt-calculation.h>
@@ -37,6 +39,7 @@
 #include <opening/pgn-save.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <format>
 
 using namespace QaplaTester;
@@ -84,7 +87,9 @@ SprtTournamentData::SprtTournamentData() :
     sprtConfiguration_(std::make_unique<ImGuiSprtConfiguration>()),
     sprtManager_(std::make_unique<SprtManager>()),
     sprtConfig_(std::make_unique<SprtConfig>()),
-    imguiConcurrency_(std::make_unique<ImGuiConcurrency>())
+    imguiConcurrency_(std::make_unique<ImGuiConcurrency>()),
+    roundJournal_((std::filesystem::path(QaplaHelpers::OsHelpers::getConfigDirectory()) 
+        / "sprt-tournament.journal").string())
 {
     ImGuiEngineSelect::Options options;
     options.allowGauntletEdit = true;
@@ -119,6 +124,11 @@ SprtTournamentData::SprtTournamentData() :
 
     // Register poll callback
     pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+        Callback::PollScheduler::Options{
+            .name = "SPRT tournament",
+            .priority = Callback::PollScheduler::Priority::Background,
+            .isVisible = [this]() { return visibility_.isVisible() || boardWindowList_.isVisible(); }
+        },
         [this]() {
             this->pollData();
         }
@@ -189,15 +199,24 @@ void SprtTournamentData::loadGlobalSettingsConfig() {
 }
 
 void SprtTournamentData::updateTournamentResults() {
-    if (sprtManager_) {
-        auto section = sprtManager_->getSection();
-        if (section.has_value()) {
-            QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
-                "round", "sprt-tournament", { *section });
-        } else {
-            QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
-                "round", "sprt-tournament", {});
-        }
+    if (!sprtManager_) {
+        return;
+    }
+    // The round section only changes with a finished game, not with every frame
+    auto games = static_cast<uint64_t>(sprtManager_->getDuelResult().total());
+    if (savedGames_ == games) {
+        return;
+    }
+    savedGames_ = games;
+    auto section = sprtManager_->getSection();
+    if (section.has_value()) {
+        QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
+            "round", "sprt-tournament", { *section });
+        roundJournal_.append(*section, journalIdentity_);
+    } else {
+        QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
+            "round", "sprt-tournament", {});
+        roundJournal_.reset();
     }
 }
 
@@ -216,21 +235,26 @@ QaplaTester::TournamentResult SprtTournamentData::getTournamentResult() const {
     return QaplaTester::TournamentResult{};
 }
 
+std::vector<EngineConfig> SprtTournamentData::getSelectedEngines() const {
+    // Build engine configurations with global settings applied
+    std::vector<EngineConfig> selectedEngines;
+    for (const auto& tournamentConfig : engineConfigurations_) {
+        if (!tournamentConfig.isSelected()) {
+            continue;
+        }
+        EngineConfig engine = tournamentConfig;
+
+        // Apply global settings to engine
+        QaplaTester::EngineGlobalConfigFile::applyGlobalConfig(engine, eachEngineConfig_);
+        
+        selectedEngines.push_back(engine);
+    }
+    return selectedEngines;
+}
+
 bool SprtTournamentData::createTournament(bool verbose) {
     try {
-        // Build engine configurations with global settings applied
-        std::vector<EngineConfig> selectedEngines;
-        for (auto& tournamentConfig : engineConfigurations_) {
-            if (!tournamentConfig.isSelected()) {
-                continue;
-            }
-            EngineConfig engine = tournamentConfig;
-
-            // Apply global settings to engine
-            QaplaTester::EngineGlobalConfigFile::applyGlobalConfig(engine, eachEngineConfig_);
-            
-            selectedEngines.push_back(engine);
-        }
+        std::vector<EngineConfig> selectedEngines = getSelectedEngines();
         if (selectedEngines.size() != 2) {
             throw std::runtime_error("SPRT tournament requires exactly 2 engines.");
         }
@@ -247,6 +271,11 @@ bool SprtTournamentData::createTournament(bool verbose) {
             poolAccess_->getAdjudicationManager().setDrawAdjudicationConfig(tournamentAdjudication_->drawConfig());
             poolAccess_->getAdjudicationManager().setResignAdjudicationConfig(tournamentAdjudication_->resignConfig());
             sprtManager_->createTournament(selectedEngines, *sprtConfig_);
+            savedGames_.reset();
+            journalIdentity_ = std::format("{}|{}|{}|{}|{}|{}|{}|{}", 
+                selectedEngines[0].getName(), selectedEngines[1].getName(),
+                sprtConfig_->eloH0, sprtConfig_->eloH1, sprtConfig_->alpha, sprtConfig_->beta,
+                sprtConfig_->maxGames, sprtConfig_->openings.file);
             
             // Clear Monte Carlo results when creating new tournament
             sprtManager_->clearMonteCarloResult();
@@ -267,7 +296,13 @@ void SprtTournamentData::loadTournament() {
         auto& configData = QaplaConfiguration::Configuration::instance().getConfigData();
         auto sections = configData.getSectionList("round", "sprt-tournament")
             .value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+        // The journal is written with every finished game, the configuration only on autosave.
+        // Rounds journaled for other engines or settings are ignored.
+        if (auto journaled = roundJournal_.latest(journalIdentity_)) {
+            sections = { *journaled };
+        }
         sprtManager_->setGameResults(sections);
+        savedGames_.reset();
     }
 }
 
@@ -348,8 +383,11 @@ void SprtTournamentData::startTournament() {
     poolAccess_->clearAll();
     state_ = State::Starting;
     
-    sprtManager_->schedule(sprtManager_, imguiConcurrency_->getExternalConcurrency(), *poolAccess_);
     imguiConcurrency_->init();
+    imguiConcurrency_->setResourceLimit(
+        ResourceBudget::instance().maxConcurrentPairings(getSelectedEngines()));
+    auto concurrency = std::min(imguiConcurrency_->getExternalConcurrency(), imguiConcurrency_->getResourceLimit());
+    sprtManager_->schedule(sprtManager_, concurrency, *poolAccess_);
     imguiConcurrency_->setActive(true);
     state_ = State::Starting;
     SnackbarManager::instance().showSuccess("SPRT tournament started",
@@ -358,6 +396,7 @@ void SprtTournamentData::startTournament() {
 
 void SprtTournamentData::pollData() {
     if (sprtManager_) {
+        imguiConcurrency_->poll();
         updateTournamentResults();
         populateResultTable();
         populateSprtTable();
@@ -437,8 +476,11 @@ void SprtTournamentData::clear() {
     state_ = State::Stopped;
     poolAccess_->clearAll();
     sprtManager_ = std::make_unique<SprtManager>();
+    savedGames_.reset();
+    roundJournal_.reset();
     
     montecarloTable_.clear();
+    montecarloValues_.clear();
     
     SnackbarManager::instance().showSuccess(message, false, "sprt-tournament");
 }
@@ -455,10 +497,26 @@ uint32_t SprtTournamentData::getExternalConcurrency() const {
     return imguiConcurrency_->getExternalConcurrency();
 }
 
+uint32_t SprtTournamentData::getResourceLimit() const {
+    return imguiConcurrency_->getResourceLimit();
+}
+
 void SprtTournamentData::setExternalConcurrency(uint32_t count) {
     imguiConcurrency_->setExternalConcurrency(count);
 }
 
+void SprtTournamentData::setAutoConcurrency(bool autoMode) {
+    imguiConcurrency_->setAutoMode(autoMode);
+}
+
+bool SprtTournamentData::isAutoConcurrency() const {
+    return imguiConcurrency_->isAutoMode();
+}
+
+uint32_t SprtTournamentData::getCurrentConcurrency() const {
+    return imguiConcurrency_->getCurrentConcurrency();
+}
+
 bool SprtTournamentData::hasResults() const {
     return (sprtManager_ != nullptr && sprtManager_->hasResults());
 }
@@ -628,17 +686,43 @@ void SprtTournamentData::populateMonteCarloTable() {
         return;
     }
 
-    montecarloTable_.clear();
-    
+    // Called every frame while the simulation streams partial results. Only new rows are
+    // formatted and only cells with changed values are rewritten.
     sprtManager_->withMonteCarloResult([this](const QaplaTester::MonteCarloResult& result) {
-        for (const auto& row : result.rows) {
-            montecarloTable_.push(std::vector<std::string>{
+        if (result.rows.size() < montecarloValues_.size()) {
+            montecarloTable_.clear();
+            montecarloValues_.clear();
+        }
+        for (size_t index = 0; index < result.rows.size(); ++index) {
+            const auto& row = result.rows[index];
+            MonteCarloValues values{
+                static_cast<double>(row.eloDifference),
+                row.noDecisionPercent,
+                row.h0AcceptedPercent,
+                row.h1AcceptedPercent,
+                row.avgGames
+            };
+            if (index < montecarloValues_.size() && values == montecarloValues_[index]) {
+                continue;
+            }
+            std::vector<std::string> cells{
                 std::to_string(row.eloDifference),
                 std::format("{:.1f}", row.noDecisionPercent),
                 std::format("{:.1f}", row.h0AcceptedPercent),
                 std::format("{:.1f}", row.h1AcceptedPercent),
                 std::format("{:.1f}", row.avgGames)
-            });
+            };
+            if (index >= montecarloValues_.size()) {
+                montecarloTable_.push(cells);
+                montecarloValues_.push_back(values);
+                continue;
+            }
+            for (size_t column = 0; column < cells.size(); ++column) {
+                if (values[column] != montecarloValues_[index][column]) {
+                    montecarloTable_.setField(index, column, cells[column]);
+                }
+            }
+            montecarloValues_[index] = values;
         }
     });
 }
@@ -702,6 +786,8 @@ void SprtTournamentData::loadTournament(const std::string& filename) {
     try {
         auto& configData = QaplaConfiguration::Configuration::instance().getConfigData();
         configData.load(filename);
+        // The rounds of the loaded file replace the journaled ones
+        roundJournal_.reset();
 
         // Reload configuration from the updated singleton
         loadEngineSelectionConfig();
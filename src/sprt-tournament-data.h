@@ -29,8 +29,11 @@
 #include "imgui-causes-table.h"
 #include "game-manager-pool-access.h"
 #include "callback-manager.h"
+#include "section-journal.h"
 
+#include <array>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <cstdint>
 
@@ -77,6 +80,14 @@ namespace QaplaWindows {
          */
         void pollData();
 
+        /**
+         * @brief Marks the window showing the data as drawn in the current frame.
+         * Visible data is polled every frame, hidden data at background rate.
+         */
+        void markDrawn() {
+            visibility_.markDrawn();
+        }
+
         /**
          * @brief Clears the current SPRT tournament results.
          */
@@ -152,12 +163,37 @@ namespace QaplaWindows {
          */
         uint32_t getExternalConcurrency() const;
 
+        /**
+         * @brief Gets the number of concurrent games fitting into the resource budget.
+         * @return The game limit of the running calculation.
+         */
+        uint32_t getResourceLimit() const;
+
         /**
          * @brief Sets the external concurrency value.
          * @param count The new external concurrency value.
          */
         void setExternalConcurrency(uint32_t count);
 
+        /**
+         * @brief Enables or disables the adaptive concurrency mode. The concurrency
+         * value then is the upper limit of the automatically chosen concurrency.
+         * @param autoMode True to enable auto mode.
+         */
+        void setAutoConcurrency(bool autoMode);
+
+        /**
+         * @brief Checks if the adaptive concurrency mode is enabled.
+         * @return True if auto mode is enabled.
+         */
+        bool isAutoConcurrency() const;
+
+        /**
+         * @brief Gets the concurrency currently applied to the pool.
+         * @return The applied concurrency.
+         */
+        uint32_t getCurrentConcurrency() const;
+
         /**
          * @brief Returns a reference to the engine selection.
          * @return Reference to the engine selection.
@@ -294,6 +330,12 @@ namespace QaplaWindows {
          */
         void setEngineConfigurations(const std::vector<ImGuiEngineSelect::EngineConfiguration>& configurations);
 
+        /**
+         * @brief Gets the selected engines with the global engine settings applied.
+         * @return Vector of EngineConfig for all selected engines.
+         */
+        std::vector<QaplaTester::EngineConfig> getSelectedEngines() const;
+
         /**
          * @brief Creates the SPRT tournament with the configured engines and settings.
          * @param verbose Whether to show error messages
@@ -319,6 +361,8 @@ namespace QaplaWindows {
          * @brief Updates the tournament results in the Configuration singleton.
          * @details This method creates Section entries for SPRT tournament result data
          *          and stores them in the Configuration singleton using setSectionList.
+         *          The section is only rebuilt when the number of played games changed,
+         *          each new state is also appended to the round journal.
          */
         void updateTournamentResults();
 
@@ -403,6 +447,7 @@ namespace QaplaWindows {
         /**
          * @brief Populates the Monte Carlo table with test results.
          * @details Fills the table with simulation results from the Monte Carlo test using a callback.
+         *          Partial results of a running test are merged into the table row by row.
          */
         void populateMonteCarloTable();
 
@@ -431,6 +476,9 @@ namespace QaplaWindows {
         ImGuiTable sprtTable_;
         ImGuiCausesTable causesTable_;
         ImGuiTable montecarloTable_;
+        /// Values of the Monte Carlo rows shown in montecarloTable_, to update only changed cells
+        using MonteCarloValues = std::array<double, 5>;
+        std::vector<MonteCarloValues> montecarloValues_;
 
         std::unique_ptr<ImGuiEngineSelect> engineSelect_;
         std::unique_ptr<ImGuiTournamentOpening> tournamentOpening_;
@@ -446,11 +494,18 @@ namespace QaplaWindows {
 
         std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
         std::unique_ptr<Callback::UnregisterHandle> messageCallbackHandle_;
+        Visibility visibility_;
 
         QaplaTester::EngineGlobalConfig eachEngineConfig_;
 
         State state_ = State::Stopped;
         bool showAllSprtModels_ = false;
+
+        /// Game count of the last written round section, std::nullopt forces the next write
+        std::optional<uint64_t> savedGames_;
+        SectionJournal roundJournal_;
+        /// Engines and SPRT settings of the created tournament, the journal keeps only its rounds
+        std::string journalIdentity_;
     };
 
 }
@@ -27,6 +27,7 @@
 #include "imgui-controls.h"
 #include "imgui-engine-global-settings.h"
 #include "configuration.h"
+#include "imgui-concurrency.h"
 
 #include <chess-game/move-record.h>
 #include <chess-game/game-record.h>
@@ -209,15 +210,31 @@ void SprtTournamentWindow::executeCommand(const std::string &button) {
 bool SprtTournamentWindow::drawInput() {
     constexpr float inputWidth = 200.0F;
     constexpr float fileInputWidth = inputWidth + 100.0F;
-    constexpr int maxConcurrency = 32;
     auto& tournamentData = SprtTournamentData::instance();
 
     ImGui::SetNextItemWidth(inputWidth);
     auto concurrency = tournamentData.getExternalConcurrency();
-    ImGuiControls::sliderInt<uint32_t>("Concurrency", concurrency, 1, maxConcurrency);
+    ImGuiControls::sliderInt<uint32_t>("Concurrency", concurrency, 1, ImGuiConcurrency::maxConcurrency());
     ImGuiControls::hooverTooltip("Number of games running in parallel");
     tournamentData.setExternalConcurrency(concurrency);
     tournamentData.setPoolConcurrency(concurrency, true);
+    ImGui::SameLine();
+    auto autoConcurrency = tournamentData.isAutoConcurrency();
+    if (ImGuiControls::checkbox("Auto", autoConcurrency)) {
+        tournamentData.setAutoConcurrency(autoConcurrency);
+    }
+    ImGuiControls::hooverTooltip("Adapts the number of parallel games to the CPU load.\n"
+        "Reduces it when games lose on time, the slider value is the upper limit.");
+    if (tournamentData.isAutoConcurrency() && tournamentData.getCurrentConcurrency() > 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(running %u)", tournamentData.getCurrentConcurrency());
+    }
+    if (tournamentData.getResourceLimit() < concurrency) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(limited to %u)", tournamentData.getResourceLimit());
+        ImGuiControls::hooverTooltip("The engines' Threads and Hash settings allow fewer parallel games.\n"
+            "The budget is configured in the Settings tab.");
+    }
     drawProgress();
     
     ImGui::Spacing();
@@ -261,6 +278,7 @@ void SprtTournamentWindow::draw() {
     constexpr float rightBorder = 5.0F;
     constexpr float windowMaxHeight = 4000.0F;
     auto& tournamentData = SprtTournamentData::instance();
+    tournamentData.markDrawn();
     drawButtons();
 
     ImGui::Indent(10.0F);
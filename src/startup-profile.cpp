@@ -0,0 +1,90 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "startup-profile.h"
+
+#include <base-elements/logger.h>
+
+#include <format>
+#include <utility>
+
+using QaplaTester::Logger;
+using QaplaTester::TraceLevel;
+
+namespace QaplaWindows {
+
+StartupProfile& StartupProfile::instance() {
+    static StartupProfile instance;
+    return instance;
+}
+
+StartupProfile::StartupProfile() 
+    : start_(Clock::now()), lastStepEnd_(start_) {}
+
+void StartupProfile::record(std::string_view name, Clock::duration elapsed, bool deferred) {
+    phases_.push_back(Phase{
+        .name = std::string(name),
+        .ms = std::chrono::duration<double, std::milli>(elapsed).count(),
+        .deferred = deferred
+    });
+    lastStepEnd_ = Clock::now();
+}
+
+void StartupProfile::defer(std::string name, std::function<void()> step) {
+    deferred_.push_back(DeferredStep{ .name = std::move(name), .step = std::move(step) });
+}
+
+void StartupProfile::frameDone() {
+    if (finished_) {
+        return;
+    }
+    finished_ = true;
+    auto now = Clock::now();
+    // Includes the font atlas build and all first time initialization done while drawing
+    record("First frame", now - lastStepEnd_, false);
+    firstFrameMs_ = std::chrono::duration<double, std::milli>(now - start_).count();
+
+    for (auto& [name, step] : std::exchange(deferred_, {})) {
+        auto start = Clock::now();
+        step();
+        record(name, Clock::now() - start, true);
+    }
+    Logger::reportLogger().log(summary(), TraceLevel::info);
+}
+
+std::string StartupProfile::summary() const {
+    std::string result = std::format("Startup: first frame after {:.0f} ms (", firstFrameMs_);
+    std::string deferred;
+    bool first = true;
+    for (const auto& phase : phases_) {
+        if (phase.deferred) {
+            deferred += std::format("{}{} {:.0f} ms", deferred.empty() ? "" : ", ", phase.name, phase.ms);
+            continue;
+        }
+        result += std::format("{}{} {:.0f} ms", first ? "" : ", ", phase.name, phase.ms);
+        first = false;
+    }
+    result += ")";
+    if (!deferred.empty()) {
+        result += ", deferred: " + deferred;
+    }
+    return result;
+}
+
+} // namespace QaplaWindows
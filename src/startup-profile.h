@@ -0,0 +1,120 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Measures the phases of the application start up to the first presented frame.
+ *
+ * runApp wraps each startup step in run(). Steps that are not needed for the first frame
+ * are registered with defer() and executed after it has been presented. The summary with
+ * the time of every phase is written to the report log once the deferred steps are done.
+ */
+class StartupProfile {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        std::string name;
+        double ms = 0.0;
+        bool deferred = false;   ///< Executed after the first frame
+    };
+
+    static StartupProfile& instance();
+
+    StartupProfile(const StartupProfile&) = delete;
+    StartupProfile& operator=(const StartupProfile&) = delete;
+
+    /**
+     * @brief Executes a startup step and records its duration.
+     * @return The result of the step.
+     */
+    template <typename Step>
+    auto run(std::string_view name, Step&& step) {
+        auto start = Clock::now();
+        if constexpr (std::is_void_v<std::invoke_result_t<Step>>) {
+            std::forward<Step>(step)();
+            record(name, Clock::now() - start, false);
+        } else {
+            auto result = std::forward<Step>(step)();
+            record(name, Clock::now() - start, false);
+            return result;
+        }
+    }
+
+    /**
+     * @brief Registers a step executed after the first frame has been presented.
+     */
+    void defer(std::string name, std::function<void()> step);
+
+    /**
+     * @brief Called after every presented frame. The first call records the first frame,
+     * runs the deferred steps and logs the summary; later calls return immediately.
+     */
+    void frameDone();
+
+    [[nodiscard]] bool isFinished() const {
+        return finished_;
+    }
+
+    [[nodiscard]] const std::vector<Phase>& phases() const {
+        return phases_;
+    }
+
+    /**
+     * @brief Time from the creation of the profile to the first presented frame.
+     */
+    [[nodiscard]] double firstFrameMs() const {
+        return firstFrameMs_;
+    }
+
+    /**
+     * @brief One line with the time to the first frame and the time of every phase.
+     */
+    [[nodiscard]] std::string summary() const;
+
+private:
+    StartupProfile();
+
+    void record(std::string_view name, Clock::duration elapsed, bool deferred);
+
+    struct DeferredStep {
+        std::string name;
+        std::function<void()> step;
+    };
+
+    Clock::time_point start_;
+    Clock::time_point lastStepEnd_;
+    std::vector<Phase> phases_;
+    std::vector<DeferredStep> deferred_;
+    double firstFrameMs_ = 0.0;
+    bool finished_ = false;
+};
+
+} // namespace QaplaWindows
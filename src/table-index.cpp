@@ -20,7 +20,10 @@
 #include "table-index.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <thread>
 #include <utility>
 
 namespace QaplaWindows {
@@ -145,6 +148,110 @@ void TableIndex::sort(const std::function<bool(size_t, size_t)>& compare) {
     std::sort(sortedIndices_.begin(), sortedIndices_.begin() + static_cast<long long>(filteredSize_), compare);
 }
 
+/**
+ * @brief Sorts a range with several threads: the chunks are sorted concurrently and then
+ * merged pairwise, each merge level again in parallel.
+ * @param begin Start of the range.
+ * @param end End of the range.
+ * @param compare Strict weak ordering.
+ */
+template <typename Iterator, typename Compare>
+static void parallelSort(Iterator begin, Iterator end, const Compare& compare) {
+    constexpr size_t parallelThreshold = 32768;
+    const auto count = static_cast<size_t>(end - begin);
+    const size_t maxThreads = std::max(1U, std::thread::hardware_concurrency());
+    const size_t chunks = std::min(maxThreads, count / (parallelThreshold / 2));
+    if (count < parallelThreshold || chunks < 2) {
+        std::sort(begin, end, compare);
+        return;
+    }
+
+    std::vector<std::ptrdiff_t> bounds;
+    for (size_t chunk = 0; chunk <= chunks; ++chunk) {
+        bounds.push_back(static_cast<std::ptrdiff_t>(count * chunk / chunks));
+    }
+
+    std::vector<std::thread> workers;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        workers.emplace_back([&, chunk]() {
+            std::sort(begin + bounds[chunk], begin + bounds[chunk + 1], compare);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t width = 1; width < chunks; width *= 2) {
+        workers.clear();
+        for (size_t chunk = 0; chunk + width < chunks; chunk += 2 * width) {
+            auto first = begin + bounds[chunk];
+            auto middle = begin + bounds[chunk + width];
+            auto last = begin + bounds[std::min(chunk + 2 * width, chunks)];
+            workers.emplace_back([first, middle, last, &compare]() {
+                std::inplace_merge(first, middle, last, compare);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Row reference with the first eight key bytes packed big endian, so most
+ * comparisons are a single integer compare without touching the key strings.
+ */
+struct KeyedRow {
+    uint64_t prefix;
+    size_t length;
+    size_t row;
+};
+
+static uint64_t keyPrefix(const std::string& key) {
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < sizeof(prefix); ++i) {
+        prefix <<= 8;
+        if (i < key.size()) {
+            prefix |= static_cast<unsigned char>(key[i]);
+        }
+    }
+    return prefix;
+}
+
+void TableIndex::sortByKeys(const std::vector<std::string>& keys, bool ascending) {
+    if (!useSortedIndices_) {
+        initFilter();
+    }
+    useSortedIndices_ = true;
+
+    std::vector<KeyedRow> keyed;
+    keyed.reserve(filteredSize_);
+    for (size_t index = 0; index < filteredSize_; ++index) {
+        const size_t row = sortedIndices_[index];
+        keyed.push_back({ .prefix = keyPrefix(keys[row]), .length = keys[row].size(), .row = row });
+    }
+
+    parallelSort(keyed.begin(), keyed.end(), [&keys, ascending](const KeyedRow& a, const KeyedRow& b) {
+        int cmp = 0;
+        if (a.prefix != b.prefix) {
+            cmp = a.prefix < b.prefix ? -1 : 1;
+        } else if (a.length <= sizeof(a.prefix) && b.length <= sizeof(b.prefix)) {
+            // Both keys are completely held in the prefix, only the zero padding may differ
+            cmp = a.length == b.length ? 0 : (a.length < b.length ? -1 : 1);
+        } else {
+            cmp = keys[a.row].compare(keys[b.row]);
+        }
+        if (cmp == 0) {
+            return a.row < b.row;
+        }
+        return ascending ? cmp < 0 : cmp > 0;
+    });
+
+    for (size_t index = 0; index < filteredSize_; ++index) {
+        sortedIndices_[index] = keyed[index].row;
+    }
+}
+
 void TableIndex::filter(const std::function<bool(size_t)>& predicate) {
     if (!useSortedIndices_) {
         initFilter();
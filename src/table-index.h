@@ -23,6 +23,7 @@
 #include <optional>
 #include <cstddef>
 #include <functional>
+#include <string>
 
 namespace QaplaWindows {
 
@@ -134,6 +135,17 @@ public:
      */
     void sort(const std::function<bool(size_t, size_t)>& compare);
 
+    /**
+     * @brief Sorts the indices by precomputed per-row sort keys.
+     * 
+     * Keys are compared byte-wise; rows with equal keys keep their row order. Large tables
+     * are sorted in parallel chunks that are merged afterwards.
+     * 
+     * @param keys One sort key per row, indexed by row number.
+     * @param ascending If true, sorts ascending, otherwise descending.
+     */
+    void sortByKeys(const std::vector<std::string>& keys, bool ascending);
+
     /**
      * @brief Filters the indices based on the provided predicate function.
      * 
@@ -0,0 +1,393 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "test-system/frame-time-tests.h"
+
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+#include <imgui.h>
+#include "imgui_te_engine.h"
+#include "imgui_te_context.h"
+#include "imgui_te_perftool.h"
+#include "imgui_te_utils.h"
+#include "test-system/test-common.h"
+#include "test-system/tournament-chatbot/tournament-test-helpers.h"
+#include "tournament-data.h"
+#include "epd-data.h"
+#include "imgui-game-list.h"
+#include "perf-hud.h"
+
+#include <engine-handling/engine-config.h>
+#include <base-elements/ini-file.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace QaplaTest {
+
+    namespace {
+
+        /**
+         * @brief Real time recorded per scenario, must be shorter than the history of the PerfHud.
+         */
+        constexpr float RECORD_SECONDS = 8.0F;
+
+        std::filesystem::path getTestDataPath() {
+            return std::filesystem::current_path() / "src" / "test-system" / "test-data";
+        }
+
+        std::string getDiagnosticEnginePath() {
+#ifdef _WIN32
+            return (getTestDataPath() / "diagnostic-engine.exe").string();
+#else
+            return (getTestDataPath() / "diagnostic-engine").string();
+#endif
+        }
+
+        std::string getTempFile(const std::string& name) {
+            return (std::filesystem::temp_directory_path() / name).string();
+        }
+
+        /**
+         * @brief Creates differently named configurations of the diagnostic engine, which
+         * answers every go command immediately.
+         */
+        std::vector<QaplaTester::EngineConfig> createDiagnosticEngines(size_t count) {
+            std::vector<QaplaTester::EngineConfig> engines;
+            for (size_t i = 0; i < count; ++i) {
+                auto config = QaplaTester::EngineConfig::createFromPath(getDiagnosticEnginePath());
+                config.setName(std::format("Diagnostic {}", i + 1));
+                config.setSelected(true);
+                engines.push_back(std::move(config));
+            }
+            return engines;
+        }
+
+        /**
+         * @brief Reads the stored p95 budget of a scenario.
+         * @return The budget in milliseconds, std::nullopt if none is stored.
+         */
+        std::optional<double> loadBudgetMs(const std::string& scenario) {
+            std::ifstream in(getTestDataPath() / "frame-budgets.ini");
+            if (!in) {
+                return std::nullopt;
+            }
+            for (const auto& section : QaplaHelpers::IniFile::load(in)) {
+                if (section.name != "framebudget" || section.getValue("id").value_or("") != scenario) {
+                    continue;
+                }
+                try {
+                    return std::stod(section.getValue("p95ms").value_or(""));
+                } catch (...) {
+                    return std::nullopt;
+                }
+            }
+            return std::nullopt;
+        }
+
+        struct FrameStats {
+            size_t frames = 0;
+            double p50Ms = 0.0;
+            double p95Ms = 0.0;
+            double minMs = 0.0;
+            double maxMs = 0.0;
+        };
+
+        /**
+         * @brief Records the CPU time of the poll and draw phases of each frame using the PerfHud.
+         * 
+         * The render phase is left out, it includes the buffer swap and thus waits for vsync.
+         */
+        class FrameTimeRecording {
+        public:
+            FrameTimeRecording() {
+                auto& perfHud = QaplaWindows::PerfHud::instance();
+                perfHud.setRecording(true);
+                const auto& history = perfHud.history();
+                startTime_ = history.empty() ? -1.0 : history.back().time;
+            }
+
+            ~FrameTimeRecording() {
+                QaplaWindows::PerfHud::instance().setRecording(false);
+            }
+
+            FrameTimeRecording(const FrameTimeRecording&) = delete;
+            FrameTimeRecording& operator=(const FrameTimeRecording&) = delete;
+
+            [[nodiscard]] FrameStats stats() const {
+                std::vector<double> samples;
+                for (const auto& frame : QaplaWindows::PerfHud::instance().history()) {
+                    if (frame.time > startTime_) {
+                        samples.push_back(static_cast<double>(frame.pollMs + frame.drawMs));
+                    }
+                }
+                FrameStats result;
+                if (samples.empty()) {
+                    return result;
+                }
+                std::ranges::sort(samples);
+                auto percentile = [&samples](double percent) {
+                    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(samples.size())));
+                    return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+                };
+                result.frames = samples.size();
+                result.p50Ms = percentile(50.0);
+                result.p95Ms = percentile(95.0);
+                result.minMs = samples.front();
+                result.maxMs = samples.back();
+                return result;
+            }
+
+        private:
+            double startTime_;
+        };
+
+        void addPerfToolEntry(ImGuiTestContext* ctx, const std::string& testName, double valueMs, const FrameStats& stats) {
+            const ImBuildInfo* buildInfo = ImBuildGetCompilationInfo();
+            ImGuiPerfToolEntry entry;
+            entry.Timestamp = ImTimeGetInMicroseconds();
+            entry.Category = "Frame time";
+            entry.TestName = testName.c_str();
+            entry.DtDeltaMs = valueMs;
+            entry.DtDeltaMsMin = stats.minMs;
+            entry.DtDeltaMsMax = stats.maxMs;
+            entry.NumSamples = static_cast<int>(stats.frames);
+            entry.PerfStressAmount = ctx->PerfStressAmount;
+            entry.GitBranchName = ctx->EngineIO->GitBranchName;
+            entry.BuildType = buildInfo->Type;
+            entry.Cpu = buildInfo->Cpu;
+            entry.OS = buildInfo->OS;
+            entry.Compiler = buildInfo->Compiler;
+            entry.Date = buildInfo->Date;
+            ImGuiPerfTool* perfTool = ImGuiTestEngine_GetPerfTool(ctx->Engine);
+            perfTool->AddEntry(&entry);
+            ImGuiTestEngine_PerfToolAppendToCSV(perfTool, &entry);
+        }
+
+        /**
+         * @brief Records the distribution in the perf tool and checks the p95 against the budget.
+         */
+        void reportFrameStats(ImGuiTestContext* ctx, const std::string& scenario, const FrameStats& stats) {
+            ctx->LogInfo("%s: %zu frames, p50 %.2f ms, p95 %.2f ms, max %.2f ms",
+                scenario.c_str(), stats.frames, stats.p50Ms, stats.p95Ms, stats.maxMs);
+            IM_CHECK(stats.frames > 0);
+
+            addPerfToolEntry(ctx, scenario + " p50", stats.p50Ms, stats);
+            addPerfToolEntry(ctx, scenario + " p95", stats.p95Ms, stats);
+
+            auto budget = loadBudgetMs(scenario);
+            if (!budget) {
+                ctx->LogWarning("No frame budget stored for %s in frame-budgets.ini", scenario.c_str());
+                return;
+            }
+            ctx->LogInfo("%s: p95 budget %.2f ms", scenario.c_str(), *budget);
+            IM_CHECK_LE(stats.p95Ms, *budget);
+        }
+
+        /**
+         * @brief Writes a PGN file with the given number of short games, if it does not exist yet.
+         */
+        std::string createLargePgn(size_t games) {
+            auto fileName = getTempFile(std::format("qapla-frame-time-{}.pgn", games));
+            if (std::filesystem::exists(fileName)) {
+                return fileName;
+            }
+            std::ofstream out(fileName, std::ios::binary);
+            constexpr std::array<const char*, 3> results = { "1-0", "0-1", "1/2-1/2" };
+            for (size_t i = 0; i < games; ++i) {
+                const char* result = results[i % results.size()];
+                out << "[Event \"Frame time test\"]\n"
+                    << "[Round \"" << (i / 8) + 1 << "\"]\n"
+                    << "[White \"Engine " << (i * 7) % 23 << "\"]\n"
+                    << "[Black \"Engine " << (i * 11) % 29 << "\"]\n"
+                    << "[Result \"" << result << "\"]\n"
+                    << "[PlyCount \"" << 6 + (i % 120) << "\"]\n\n"
+                    << "1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 " << result << "\n\n";
+            }
+            return fileName;
+        }
+
+        /**
+         * @brief Clicks the first of the given references that exists.
+         */
+        bool clickFirstExisting(ImGuiTestContext* ctx, std::initializer_list<const char*> refs) {
+            for (const char* ref : refs) {
+                if (ctx->ItemExists(ref)) {
+                    ctx->ItemClick(ref);
+                    return true;
+                }
+            }
+            ctx->LogError("None of the items found, first: %s", *refs.begin());
+            return false;
+        }
+
+    }
+
+    void registerFrameTimeTests(ImGuiTestEngine* engine) {
+        ImGuiTest* t = nullptr;
+
+        // -----------------------------------------------------------------
+        // Tournament with 32 concurrent games of the diagnostic engine,
+        // tournament tab visible
+        // -----------------------------------------------------------------
+        t = IM_REGISTER_TEST(engine, "Perf/FrameTime", "Tournament32Games");
+        t->TestFunc = [](ImGuiTestContext* ctx) {
+            using QaplaTest::TournamentChatbot::cleanupTournamentState;
+            using QaplaTest::TournamentChatbot::waitForTournamentRunning;
+            using QaplaTest::TournamentChatbot::waitForTournamentStopped;
+            constexpr uint32_t concurrency = 32;
+
+            cleanupTournamentState();
+            IM_CHECK(std::filesystem::exists(getDiagnosticEnginePath()));
+
+            auto& tournamentData = QaplaWindows::TournamentData::instance();
+            auto previousConcurrency = tournamentData.getExternalConcurrency();
+            tournamentData.getEngineSelect().setEngineConfigurations(createDiagnosticEngines(4));
+            tournamentData.tournamentOpening().openings() = QaplaTester::Openings{};
+            tournamentData.tournamentPgn().pgnOptions().file = getTempFile("qapla-frame-time-tournament.pgn");
+            QaplaWindows::ImGuiEngineGlobalSettings::TimeControlSettings timeControl;
+            timeControl.timeControl = "10.0+0.1";
+            tournamentData.getGlobalSettings().setTimeControlSettings(timeControl);
+            // Six pairings with 16 games each per round, enough to keep 32 games running
+            tournamentData.config().rounds = 10;
+            tournamentData.config().games = 16;
+            tournamentData.config().repeat = 2;
+            tournamentData.setExternalConcurrency(concurrency);
+            tournamentData.setPoolConcurrency(concurrency, true, true);
+
+            tournamentData.startTournament(false);
+            IM_CHECK(waitForTournamentRunning(ctx, 10.0F));
+            ctx->ItemClick("**/###Tournament");
+            ctx->Yield(10);
+            ctx->LogInfo("Running %u concurrent games", tournamentData.getCurrentConcurrency());
+
+            FrameStats stats;
+            {
+                FrameTimeRecording recording;
+                ctx->SleepNoSkip(RECORD_SECONDS, Common::FRAME_STEP);
+                stats = recording.stats();
+            }
+
+            tournamentData.stopPool(false);
+            waitForTournamentStopped(ctx, 10.0F);
+            cleanupTournamentState();
+            tournamentData.setExternalConcurrency(previousConcurrency);
+            tournamentData.setPoolConcurrency(previousConcurrency, true, true);
+
+            reportFrameStats(ctx, "Tournament32Games", stats);
+        };
+
+        // -----------------------------------------------------------------
+        // Game list with 100k games: scrolling and sorting
+        // -----------------------------------------------------------------
+        t = IM_REGISTER_TEST(engine, "Perf/FrameTime", "GameList100k");
+        t->TestFunc = [](ImGuiTestContext* ctx) {
+            constexpr size_t games = 100000;
+            constexpr int scrollSteps = 20;
+
+            ctx->ItemClick("**/###Pgn");
+            ctx->Yield(2);
+            QaplaWindows::ImGuiGameList::requestLoad(createLargePgn(games));
+            IM_CHECK(Common::waitForCondition(ctx, 
+                []() { return QaplaWindows::ImGuiGameList::displayedGames() == games; }, 120.0F));
+            ctx->Yield(10);
+
+            FrameStats stats;
+            {
+                FrameTimeRecording recording;
+                IM_CHECK(clickFirstExisting(ctx, { "**/GameListTable/White", "**/White" }));
+                ctx->Yield(5);
+                ImGuiIO& io = ImGui::GetIO();
+                ctx->MouseMoveToPos(ImVec2(io.MousePos.x, io.MousePos.y + 200.0F));
+                for (int step = 0; step < scrollSteps; ++step) {
+                    ctx->MouseWheelY(-10.0F);
+                    ctx->Yield(2);
+                }
+                IM_CHECK(clickFirstExisting(ctx, { "**/GameListTable/PlyCount", "**/PlyCount" }));
+                ctx->Yield(5);
+                IM_CHECK(clickFirstExisting(ctx, { "**/GameListTable/PlyCount", "**/PlyCount" }));
+                ctx->Yield(5);
+                for (int step = 0; step < scrollSteps; ++step) {
+                    ctx->MouseWheelY(10.0F);
+                    ctx->Yield(2);
+                }
+                stats = recording.stats();
+            }
+
+            reportFrameStats(ctx, "GameList100k", stats);
+        };
+
+        // -----------------------------------------------------------------
+        // EPD analysis with 8 engines running in parallel, EPD tab visible
+        // -----------------------------------------------------------------
+        t = IM_REGISTER_TEST(engine, "Perf/FrameTime", "Epd8Engines");
+        t->TestFunc = [](ImGuiTestContext* ctx) {
+            constexpr uint32_t engineCount = 8;
+            auto epdFile = getTestDataPath() / "wmtest.epd";
+            IM_CHECK(std::filesystem::exists(epdFile));
+            IM_CHECK(std::filesystem::exists(getDiagnosticEnginePath()));
+
+            auto& epdData = QaplaWindows::EpdData::instance();
+            if (epdData.isRunning() || epdData.isStarting()) {
+                epdData.stopPool(false);
+            }
+            epdData.clear();
+            auto previousConcurrency = epdData.getExternalConcurrency();
+            auto& config = epdData.config();
+            config.filepath = epdFile.string();
+            config.maxTimeInS = 1;
+            config.minTimeInS = 1;
+            config.seenPlies = 0;
+            config.engines = createDiagnosticEngines(engineCount);
+            epdData.updateConfiguration();
+            epdData.setExternalConcurrency(engineCount);
+            epdData.setPoolConcurrency(engineCount, true);
+
+            epdData.analyse();
+            IM_CHECK(Common::waitForCondition(ctx, [&epdData]() { return epdData.isRunning(); }, 10.0F));
+            ctx->ItemClick("**/###Epd");
+            ctx->Yield(10);
+
+            FrameStats stats;
+            {
+                FrameTimeRecording recording;
+                ctx->SleepNoSkip(RECORD_SECONDS, Common::FRAME_STEP);
+                stats = recording.stats();
+            }
+
+            epdData.stopPool(false);
+            Common::waitForCondition(ctx, [&epdData]() { return epdData.isStopped(); }, 10.0F);
+            epdData.clear();
+            epdData.setExternalConcurrency(previousConcurrency);
+            epdData.setPoolConcurrency(previousConcurrency, true);
+
+            reportFrameStats(ctx, "Epd8Engines", stats);
+        };
+    }
+
+} // namespace QaplaTest
+
+#endif
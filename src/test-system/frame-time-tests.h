@@ -0,0 +1,38 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+struct ImGuiTestEngine;
+
+namespace QaplaTest {
+
+    /**
+     * @brief Registers the frame time regression tests with the engine.
+     * 
+     * Each test drives the GUI under a heavy load, records the CPU time of every frame 
+     * and fails if the 95th percentile exceeds the budget stored in 
+     * src/test-system/test-data/frame-budgets.ini.
+     * @param engine The test engine instance.
+     */
+    void registerFrameTimeTests(ImGuiTestEngine* engine);
+
+} // namespace QaplaTest
+#endif
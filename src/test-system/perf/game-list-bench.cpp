@@ -0,0 +1,104 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "game-record-manager.h"
+#include "game-filter-data.h"
+#include "perf-helpers.h"
+#include "perf-allocations.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace QaplaWindows;
+
+namespace {
+    constexpr size_t PGN_COPIES = 200;
+
+    /**
+     * @brief Writes test/Noomen.pgn PGN_COPIES times into a temporary file.
+     * @return Path of the scaled PGN file.
+     */
+    std::string scaledNoomenPgn() {
+        auto target = std::filesystem::temp_directory_path() / "qapla-perf-noomen.pgn";
+        std::ifstream in(QaplaPerf::sourcePath("test/Noomen.pgn"));
+        std::stringstream content;
+        content << in.rdbuf();
+        std::ofstream out(target, std::ios::trunc);
+        for (size_t i = 0; i < PGN_COPIES; ++i) {
+            out << content.str() << "\n";
+        }
+        return target.string();
+    }
+}
+
+TEST_CASE("GameRecordManager load", "[perf][game-list]") {
+    auto fileName = scaledNoomenPgn();
+
+    BENCHMARK("load scaled Noomen.pgn") {
+        QaplaPerf::AllocationScope allocations;
+        GameRecordManager manager;
+        manager.load(fileName);
+        return manager.getGames().size();
+    };
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_CASE("GameFilterData passesFilter", "[perf][game-list]") {
+    auto fileName = scaledNoomenPgn();
+    GameRecordManager manager;
+    manager.load(fileName);
+    const auto& games = manager.getGames();
+    REQUIRE(!games.empty());
+
+    GameFilterData filter;
+    filter.updateAvailableOptions(games);
+    const auto& names = filter.getAvailableNames();
+    REQUIRE(names.size() >= 2);
+    filter.setSelectedPlayers({ names[0], names[1] });
+    filter.setActive(true);
+
+    BENCHMARK("player filter") {
+        QaplaPerf::AllocationScope allocations;
+        size_t passed = 0;
+        for (const auto& game : games) {
+            passed += filter.passesFilter(game) ? 1 : 0;
+        }
+        return passed;
+    };
+
+    const auto& results = filter.getAvailableOptions("results");
+    if (!results.empty()) {
+        filter.setSelectedOptions("results", { results.front() });
+    }
+    BENCHMARK("player and result filter") {
+        QaplaPerf::AllocationScope allocations;
+        size_t passed = 0;
+        for (const auto& game : games) {
+            passed += filter.passesFilter(game) ? 1 : 0;
+        }
+        return passed;
+    };
+
+    std::filesystem::remove(fileName);
+}
@@ -0,0 +1,64 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "i18n.h"
+#include "translation-key.h"
+#include "translation-normalizer.h"
+#include "perf-allocations.h"
+
+#include <string>
+#include <vector>
+
+using QaplaWindows::Translator;
+using QaplaWindows::TranslationKey;
+using QaplaWindows::TranslationNormalizer;
+
+namespace {
+    /**
+     * @brief Registers a translation under the same lookup key translate() computes,
+     * so the benchmark measures the hit path and never reports missing keys.
+     */
+    void addKnownKey(Translator& translator, const std::string& topic, const std::string& key) {
+        TranslationNormalizer normalizer(key);
+        TranslationKey translationKey(normalizer.getNormalizedKey());
+        translator.addTranslation(topic, translationKey.getLookupKey(), normalizer.getNormalizedKey());
+    }
+}
+
+TEST_CASE("Translator translate", "[perf][i18n]") {
+    auto& translator = Translator::instance();
+    const std::vector<std::string> keys{ 
+        "Engines", "Tournament", "Start", "Stop", "Concurrency",
+        "Time control", "Games per pairing", "Engine 42", "Round 7 of 12",
+        "The tournament is running. Stop it before changing the engines of the tournament." };
+    for (const auto& key : keys) {
+        addKnownKey(translator, "Perf", key);
+    }
+
+    BENCHMARK("translate known keys") {
+        QaplaPerf::AllocationScope allocations;
+        size_t length = 0;
+        for (const auto& key : keys) {
+            length += translator.translate("Perf", key).size();
+        }
+        return length;
+    };
+}
@@ -0,0 +1,75 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "perf-allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> scopeAllocations{0};
+    std::atomic<uint64_t> scopes{0};
+}
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept {
+    std::free(memory);
+}
+
+namespace QaplaPerf {
+
+AllocationScope::AllocationScope() : start_(totalAllocations()) {
+}
+
+AllocationScope::~AllocationScope() {
+    scopeAllocations.fetch_add(totalAllocations() - start_, std::memory_order_relaxed);
+    scopes.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t AllocationScope::totalAllocations() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+void AllocationScope::reset() {
+    scopeAllocations = 0;
+    scopes = 0;
+}
+
+double AllocationScope::average() {
+    uint64_t count = scopes.load();
+    if (count == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(scopeAllocations.load()) / static_cast<double>(count);
+}
+
+}
@@ -0,0 +1,61 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace QaplaPerf {
+
+/**
+ * @brief Counts heap allocations inside benchmark bodies.
+ *
+ * perf-tests replaces the global operator new, every allocation increments a counter.
+ * Placing an AllocationScope at the start of a BENCHMARK body attributes the allocations
+ * of one iteration to the running benchmark. The listener resets the statistics when a
+ * benchmark starts and reads the average when it ends, so warmup and Catch2's own
+ * analysis are not counted.
+ */
+class AllocationScope {
+public:
+    AllocationScope();
+    ~AllocationScope();
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    /**
+     * @brief Total number of allocations of the process since start.
+     */
+    static uint64_t totalAllocations();
+
+    /**
+     * @brief Clears the allocations and iterations collected so far.
+     */
+    static void reset();
+
+    /**
+     * @brief Average allocations per scope since the last reset, 0 if no scope was run.
+     */
+    static double average();
+
+private:
+    uint64_t start_;
+};
+
+}
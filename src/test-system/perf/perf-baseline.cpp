@@ -0,0 +1,337 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "perf-baseline.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+namespace QaplaPerf {
+
+namespace {
+
+    /**
+     * @brief Minimal reader for the flat JSON written by PerfReport: objects, arrays,
+     * strings and numbers.
+     */
+    class JsonCursor {
+    public:
+        explicit JsonCursor(const std::string& text) : text_(text) {}
+
+        bool consume(char expected) {
+            skipSpace();
+            if (pos_ < text_.size() && text_[pos_] == expected) {
+                ++pos_;
+                return true;
+            }
+            return false;
+        }
+
+        bool peek(char expected) {
+            skipSpace();
+            return pos_ < text_.size() && text_[pos_] == expected;
+        }
+
+        std::optional<std::string> string() {
+            if (!consume('"')) {
+                return std::nullopt;
+            }
+            std::string result;
+            while (pos_ < text_.size() && text_[pos_] != '"') {
+                char c = text_[pos_++];
+                if (c == '\\' && pos_ < text_.size()) {
+                    char escaped = text_[pos_++];
+                    c = escaped == 'n' ? '\n' : (escaped == 't' ? '\t' : escaped);
+                }
+                result += c;
+            }
+            if (pos_ >= text_.size()) {
+                return std::nullopt;
+            }
+            ++pos_;
+            return result;
+        }
+
+        std::optional<double> number() {
+            skipSpace();
+            const char* begin = text_.c_str() + pos_;
+            char* end = nullptr;
+            double value = std::strtod(begin, &end);
+            if (end == begin) {
+                return std::nullopt;
+            }
+            pos_ += static_cast<size_t>(end - begin);
+            return value;
+        }
+
+        bool atEnd() {
+            skipSpace();
+            return pos_ >= text_.size();
+        }
+
+    private:
+        void skipSpace() {
+            while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+                ++pos_;
+            }
+        }
+
+        const std::string& text_;
+        size_t pos_ = 0;
+    };
+
+    bool setField(BenchmarkResult& result, const std::string& key, JsonCursor& cursor) {
+        if (key == "testCase" || key == "name") {
+            auto value = cursor.string();
+            if (!value) {
+                return false;
+            }
+            (key == "name" ? result.name : result.testCase) = *value;
+            return true;
+        }
+        auto value = cursor.number();
+        if (!value) {
+            return false;
+        }
+        if (key == "samples") result.samples = static_cast<uint64_t>(*value);
+        else if (key == "iterations") result.iterations = static_cast<uint64_t>(*value);
+        else if (key == "meanNs") result.meanNs = *value;
+        else if (key == "medianNs") result.medianNs = *value;
+        else if (key == "p95Ns") result.p95Ns = *value;
+        else if (key == "stdDevNs") result.stdDevNs = *value;
+        else if (key == "allocations") result.allocations = *value;
+        return true;
+    }
+
+    std::optional<BenchmarkResult> parseBenchmark(JsonCursor& cursor) {
+        BenchmarkResult result;
+        if (!cursor.consume('{')) {
+            return std::nullopt;
+        }
+        if (cursor.consume('}')) {
+            return result;
+        }
+        do {
+            auto key = cursor.string();
+            if (!key || !cursor.consume(':') || !setField(result, *key, cursor)) {
+                return std::nullopt;
+            }
+        } while (cursor.consume(','));
+        if (!cursor.consume('}')) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    bool exceeds(double baseline, double current, double percent, double slack = 0.0) {
+        return current > baseline * (1.0 + percent / 100.0) + slack;
+    }
+
+    std::string formatDiff(double baseline, double current) {
+        if (baseline <= 0.0) {
+            return current > 0.0 ? "new" : "0.0%";
+        }
+        std::ostringstream out;
+        double diff = (current - baseline) / baseline * 100.0;
+        out << std::showpos << std::fixed << std::setprecision(1) << diff << "%";
+        return out.str();
+    }
+
+    std::string formatCount(double count) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(count < 10.0 ? 1 : 0) << count;
+        return out.str();
+    }
+
+    std::string toString(PerfBaseline::Status status) {
+        switch (status) {
+            case PerfBaseline::Status::Pass: return "pass";
+            case PerfBaseline::Status::Fail: return "FAIL";
+            case PerfBaseline::Status::New: return "new";
+            case PerfBaseline::Status::Missing: return "not run";
+        }
+        return "";
+    }
+}
+
+std::optional<std::vector<BenchmarkResult>> PerfBaseline::parse(const std::string& json) {
+    JsonCursor cursor(json);
+    std::vector<BenchmarkResult> results;
+    if (!cursor.consume('{')) {
+        return std::nullopt;
+    }
+    auto key = cursor.string();
+    if (!key || *key != "benchmarks" || !cursor.consume(':') || !cursor.consume('[')) {
+        return std::nullopt;
+    }
+    if (!cursor.peek(']')) {
+        do {
+            auto result = parseBenchmark(cursor);
+            if (!result) {
+                return std::nullopt;
+            }
+            results.push_back(std::move(*result));
+        } while (cursor.consume(','));
+    }
+    if (!cursor.consume(']') || !cursor.consume('}') || !cursor.atEnd()) {
+        return std::nullopt;
+    }
+    return results;
+}
+
+std::optional<std::vector<BenchmarkResult>> PerfBaseline::load(const std::string& fileName) {
+    std::ifstream file(fileName);
+    if (!file) {
+        return std::nullopt;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return parse(content.str());
+}
+
+std::vector<BenchmarkResult> PerfBaseline::merge(const std::vector<BenchmarkResult>& baseline,
+    const std::vector<BenchmarkResult>& current) {
+    std::vector<BenchmarkResult> merged = baseline;
+    for (const auto& result : current) {
+        auto it = std::ranges::find_if(merged, 
+            [&result](const BenchmarkResult& entry) { return entry.key() == result.key(); });
+        if (it != merged.end()) {
+            *it = result;
+        } else {
+            merged.push_back(result);
+        }
+    }
+    return merged;
+}
+
+std::vector<PerfBaseline::Comparison> PerfBaseline::compare(const std::vector<BenchmarkResult>& baseline,
+    const std::vector<BenchmarkResult>& current, const Tolerances& tolerances) {
+    std::unordered_map<std::string, const BenchmarkResult*> currentByKey;
+    for (const auto& result : current) {
+        currentByKey[result.key()] = &result;
+    }
+
+    std::vector<Comparison> comparisons;
+    for (const auto& base : baseline) {
+        Comparison comparison{ .key = base.key(), .baseline = base };
+        auto it = currentByKey.find(comparison.key);
+        if (it == currentByKey.end()) {
+            comparison.status = Status::Missing;
+            comparisons.push_back(std::move(comparison));
+            continue;
+        }
+        const auto& now = *it->second;
+        comparison.current = now;
+        // Half an allocation of slack absorbs rounding of the per iteration average
+        bool regressed = exceeds(base.medianNs, now.medianNs, tolerances.medianPercent)
+            || exceeds(base.p95Ns, now.p95Ns, tolerances.p95Percent)
+            || exceeds(base.allocations, now.allocations, tolerances.allocationPercent, 0.5);
+        comparison.status = regressed ? Status::Fail : Status::Pass;
+        currentByKey.erase(it);
+        comparisons.push_back(std::move(comparison));
+    }
+    for (const auto& result : current) {
+        if (currentByKey.contains(result.key())) {
+            comparisons.push_back({ .key = result.key(), .current = result, .status = Status::New });
+        }
+    }
+    return comparisons;
+}
+
+bool PerfBaseline::passed(const std::vector<Comparison>& comparisons) {
+    return std::ranges::none_of(comparisons, 
+        [](const Comparison& comparison) { return comparison.status == Status::Fail; });
+}
+
+std::string PerfBaseline::formatDuration(double ns) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    if (ns >= 1e9) {
+        out << ns / 1e9 << " s";
+    } else if (ns >= 1e6) {
+        out << ns / 1e6 << " ms";
+    } else if (ns >= 1e3) {
+        out << ns / 1e3 << " us";
+    } else {
+        out << ns << " ns";
+    }
+    return out.str();
+}
+
+std::string PerfBaseline::formatTable(const std::vector<Comparison>& comparisons) {
+    const std::vector<std::string> header{ "Benchmark", "Median base", "Median now", "Diff",
+        "P95 base", "P95 now", "Diff", "Allocs base", "Allocs now", "Status" };
+
+    std::vector<std::vector<std::string>> rows;
+    for (const auto& comparison : comparisons) {
+        const auto& base = comparison.baseline;
+        const auto& now = comparison.current;
+        rows.push_back({
+            comparison.key,
+            base ? formatDuration(base->medianNs) : "-",
+            now ? formatDuration(now->medianNs) : "-",
+            base && now ? formatDiff(base->medianNs, now->medianNs) : "-",
+            base ? formatDuration(base->p95Ns) : "-",
+            now ? formatDuration(now->p95Ns) : "-",
+            base && now ? formatDiff(base->p95Ns, now->p95Ns) : "-",
+            base ? formatCount(base->allocations) : "-",
+            now ? formatCount(now->allocations) : "-",
+            toString(comparison.status)
+        });
+    }
+
+    std::vector<size_t> widths(header.size());
+    for (size_t col = 0; col < header.size(); ++col) {
+        widths[col] = header[col].size();
+        for (const auto& row : rows) {
+            widths[col] = std::max(widths[col], row[col].size());
+        }
+    }
+
+    std::ostringstream out;
+    auto writeRow = [&out, &widths](const std::vector<std::string>& row) {
+        for (size_t col = 0; col < row.size(); ++col) {
+            if (col + 1 == row.size()) {
+                out << "  " << row[col];
+                break;
+            }
+            // Left align the benchmark name, right align the numbers
+            out << (col == 0 ? "" : "  ") 
+                << (col == 0 ? std::left : std::right) << std::setw(static_cast<int>(widths[col])) << row[col];
+        }
+        out << "\n";
+    };
+    writeRow(header);
+    size_t total = 0;
+    for (size_t width : widths) {
+        total += width + 2;
+    }
+    out << std::string(total - 2, '-') << "\n";
+    for (const auto& row : rows) {
+        writeRow(row);
+    }
+    return out.str();
+}
+
+}
@@ -0,0 +1,103 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include "perf-report.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace QaplaPerf {
+
+/**
+ * @brief Stores benchmark baselines and compares a run against them.
+ *
+ * The baseline uses the JSON format written by PerfReport. A comparison fails, if the
+ * median, the p95 or the allocations per iteration of a benchmark exceed the baseline
+ * by more than the configured tolerance.
+ */
+class PerfBaseline {
+public:
+    /**
+     * @brief Allowed slowdown in percent of the baseline value.
+     */
+    struct Tolerances {
+        double medianPercent = 10.0;
+        double p95Percent = 25.0;
+        double allocationPercent = 10.0;
+    };
+
+    enum class Status {
+        Pass,
+        Fail,
+        New,      ///< Benchmark not in the baseline
+        Missing   ///< Baseline benchmark not run
+    };
+
+    struct Comparison {
+        std::string key{};
+        std::optional<BenchmarkResult> baseline{};
+        std::optional<BenchmarkResult> current{};
+        Status status = Status::Pass;
+    };
+
+    /**
+     * @brief Parses a JSON document written by PerfReport::toJson.
+     * @return The benchmarks, std::nullopt if the document is malformed.
+     */
+    static std::optional<std::vector<BenchmarkResult>> parse(const std::string& json);
+
+    /**
+     * @brief Reads and parses a baseline file.
+     * @return The benchmarks, std::nullopt if the file is missing or malformed.
+     */
+    static std::optional<std::vector<BenchmarkResult>> load(const std::string& fileName);
+
+    /**
+     * @brief Replaces the baseline entries of all benchmarks in current and keeps the others,
+     * so that a filtered run only updates its own benchmarks.
+     */
+    static std::vector<BenchmarkResult> merge(const std::vector<BenchmarkResult>& baseline,
+        const std::vector<BenchmarkResult>& current);
+
+    /**
+     * @brief Compares a run against the baseline, in baseline order followed by new benchmarks.
+     */
+    static std::vector<Comparison> compare(const std::vector<BenchmarkResult>& baseline,
+        const std::vector<BenchmarkResult>& current, const Tolerances& tolerances);
+
+    /**
+     * @brief True, if no comparison failed.
+     */
+    static bool passed(const std::vector<Comparison>& comparisons);
+
+    /**
+     * @brief Renders the comparisons as a fixed width diff table.
+     */
+    static std::string formatTable(const std::vector<Comparison>& comparisons);
+
+    /**
+     * @brief Formats nanoseconds with a fitting unit, e.g. "12.3 us".
+     */
+    static std::string formatDuration(double ns);
+};
+
+}
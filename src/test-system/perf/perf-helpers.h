@@ -0,0 +1,64 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#ifndef QAPLA_PERF_SOURCE_DIR
+#define QAPLA_PERF_SOURCE_DIR "."
+#endif
+
+#ifndef QAPLA_PERF_BINARY_DIR
+#define QAPLA_PERF_BINARY_DIR "."
+#endif
+
+namespace QaplaPerf {
+
+/**
+ * @brief Resolves a path relative to the repository root, independent of the working directory.
+ * @param relative Path relative to the repository root, e.g. "test/Noomen.pgn".
+ */
+inline std::string sourcePath(const std::string& relative) {
+    return std::string(QAPLA_PERF_SOURCE_DIR) + "/" + relative;
+}
+
+/**
+ * @brief Resolves a path relative to the build directory, e.g. "bin/diagnostic-engine-instant".
+ */
+inline std::string binaryPath(const std::string& relative) {
+    return std::string(QAPLA_PERF_BINARY_DIR) + "/" + relative;
+}
+
+/**
+ * @brief Settings of the pool throughput benchmark, set from the perf-tests command line.
+ */
+struct ThroughputOptions {
+    uint32_t maxConcurrency = 8;   ///< Highest concurrency, measured in powers of two up to this
+    uint32_t minGames = 24;        ///< Games per concurrency level, at least 4 per concurrent game
+    std::string engine;            ///< Instant engine, empty for the diagnostic engine of the build
+};
+
+inline ThroughputOptions& throughputOptions() {
+    static ThroughputOptions options;
+    return options;
+}
+
+}
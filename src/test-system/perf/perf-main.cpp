@@ -0,0 +1,168 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_session.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+
+#include "perf-report.h"
+#include "perf-baseline.h"
+#include "perf-allocations.h"
+#include "perf-helpers.h"
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using QaplaPerf::AllocationScope;
+using QaplaPerf::PerfBaseline;
+using QaplaPerf::PerfReport;
+
+namespace {
+
+    /**
+     * @brief Forwards the sample times and allocations of every finished benchmark to the PerfReport.
+     */
+    class PerfReportListener : public Catch::EventListenerBase {
+    public:
+        using Catch::EventListenerBase::EventListenerBase;
+
+        void testCaseStarting(const Catch::TestCaseInfo& testInfo) override {
+            testCase_ = testInfo.name;
+        }
+
+        void benchmarkStarting(const Catch::BenchmarkInfo& /*info*/) override {
+            AllocationScope::reset();
+        }
+
+        void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+            double allocations = AllocationScope::average();
+            std::vector<double> samplesNs;
+            samplesNs.reserve(stats.samples.size());
+            for (const auto& sample : stats.samples) {
+                samplesNs.push_back(sample.count());
+            }
+            auto result = PerfReport::summarize(testCase_, stats.info.name,
+                std::move(samplesNs), static_cast<uint64_t>(stats.info.iterations));
+            result.allocations = allocations;
+            PerfReport::instance().add(std::move(result));
+        }
+
+    private:
+        std::string testCase_;
+    };
+
+}
+
+CATCH_REGISTER_LISTENER(PerfReportListener)
+
+namespace {
+
+    /**
+     * @brief Writes the results of this run into the baseline, keeping benchmarks that were not run.
+     */
+    int saveBaseline(const std::string& baselineFile) {
+        auto baseline = PerfBaseline::load(baselineFile).value_or(std::vector<QaplaPerf::BenchmarkResult>{});
+        PerfReport merged;
+        for (auto& result : PerfBaseline::merge(baseline, PerfReport::instance().results())) {
+            merged.add(std::move(result));
+        }
+        if (!merged.writeJson(baselineFile)) {
+            std::cerr << "Could not write baseline " << baselineFile << "\n";
+            return 1;
+        }
+        std::cout << "Baseline written to " << baselineFile << "\n";
+        return 0;
+    }
+
+    /**
+     * @brief Prints the diff table against the baseline.
+     * @return 0, if no benchmark regressed beyond the tolerances or no baseline exists.
+     */
+    int compareBaseline(const std::string& baselineFile, const PerfBaseline::Tolerances& tolerances) {
+        // No baseline is committed, timings are only comparable on the machine that recorded them
+        std::error_code error;
+        if (!std::filesystem::exists(baselineFile, error)) {
+            std::cout << "\nNo baseline " << baselineFile << ", comparison skipped.\n"
+                << "Record one on this machine with --perf-save.\n";
+            return 0;
+        }
+        auto baseline = PerfBaseline::load(baselineFile);
+        if (!baseline) {
+            std::cerr << "Could not read baseline " << baselineFile << "\n";
+            return 1;
+        }
+        auto comparisons = PerfBaseline::compare(*baseline, PerfReport::instance().results(), tolerances);
+        bool passed = PerfBaseline::passed(comparisons);
+        std::cout << "\n" << PerfBaseline::formatTable(comparisons)
+            << "\nTolerances: median " << tolerances.medianPercent << "%, p95 " << tolerances.p95Percent
+            << "%, allocations " << tolerances.allocationPercent << "%\n"
+            << (passed ? "Performance check passed" : "Performance check FAILED") << "\n";
+        return passed ? 0 : 1;
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+    Catch::Session session;
+    std::string jsonFile;
+    std::string baselineFile = QaplaPerf::sourcePath("src/test-system/test-data/perf-baseline.json");
+    bool save = false;
+    bool compare = false;
+    PerfBaseline::Tolerances tolerances;
+    auto& throughput = QaplaPerf::throughputOptions();
+
+    using namespace Catch::Clara;
+    auto cli = session.cli()
+        | Opt(jsonFile, "file")["--perf-json"]("write the benchmark summary as JSON to this file")
+        | Opt(baselineFile, "file")["--perf-baseline"]("baseline file for --perf-save and --perf-compare")
+        | Opt(save)["--perf-save"]("store the results of this run in the baseline")
+        | Opt(compare)["--perf-compare"]("compare against the baseline, fails on regressions")
+        | Opt(tolerances.medianPercent, "percent")["--perf-tolerance"]("allowed median slowdown (default 10)")
+        | Opt(tolerances.p95Percent, "percent")["--perf-p95-tolerance"]("allowed p95 slowdown (default 25)")
+        | Opt(tolerances.allocationPercent, "percent")["--perf-alloc-tolerance"]
+            ("allowed increase of allocations per iteration (default 10)")
+        | Opt(throughput.maxConcurrency, "n")["--throughput-concurrency"]
+            ("highest concurrency of the [throughput] benchmark (default 8)")
+        | Opt(throughput.minGames, "n")["--throughput-games"]("minimum games per concurrency level (default 24)")
+        | Opt(throughput.engine, "file")["--throughput-engine"]
+            ("instant engine of the [throughput] benchmark (default bin/diagnostic-engine-instant)");
+    session.cli(cli);
+
+    int result = session.applyCommandLine(argc, argv);
+    if (result != 0) {
+        return result;
+    }
+    result = session.run();
+
+    if (!jsonFile.empty() && !PerfReport::instance().writeJson(jsonFile)) {
+        std::cerr << "Could not write " << jsonFile << "\n";
+        result = 1;
+    }
+    if (compare && compareBaseline(baselineFile, tolerances) != 0) {
+        result = 1;
+    }
+    if (save && saveBaseline(baselineFile) != 0) {
+        result = 1;
+    }
+    return result;
+}
@@ -0,0 +1,118 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "perf-report.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+namespace QaplaPerf {
+
+namespace {
+    std::string escapeJson(const std::string& text) {
+        std::string result;
+        result.reserve(text.size());
+        for (char c : text) {
+            switch (c) {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        result += ' ';
+                    } else {
+                        result += c;
+                    }
+            }
+        }
+        return result;
+    }
+}
+
+PerfReport& PerfReport::instance() {
+    static PerfReport instance;
+    return instance;
+}
+
+double PerfReport::percentile(const std::vector<double>& sorted, double percent) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted.size())));
+    rank = std::clamp<size_t>(rank, 1, sorted.size());
+    return sorted[rank - 1];
+}
+
+BenchmarkResult PerfReport::summarize(const std::string& testCase, const std::string& name,
+    std::vector<double> samplesNs, uint64_t iterations) {
+    BenchmarkResult result{ .testCase = testCase, .name = name };
+    result.samples = samplesNs.size();
+    result.iterations = iterations;
+    if (samplesNs.empty()) {
+        return result;
+    }
+    std::ranges::sort(samplesNs);
+    auto count = static_cast<double>(samplesNs.size());
+    result.meanNs = std::accumulate(samplesNs.begin(), samplesNs.end(), 0.0) / count;
+    result.medianNs = percentile(samplesNs, 50.0);
+    result.p95Ns = percentile(samplesNs, 95.0);
+    double squares = 0.0;
+    for (double sample : samplesNs) {
+        squares += (sample - result.meanNs) * (sample - result.meanNs);
+    }
+    result.stdDevNs = std::sqrt(squares / count);
+    return result;
+}
+
+std::string PerfReport::toJson() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    out << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results_.size(); ++i) {
+        const auto& result = results_[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"testCase\": \"" << escapeJson(result.testCase) << "\""
+            << ", \"name\": \"" << escapeJson(result.name) << "\""
+            << ", \"samples\": " << result.samples
+            << ", \"iterations\": " << result.iterations
+            << ", \"meanNs\": " << result.meanNs
+            << ", \"medianNs\": " << result.medianNs
+            << ", \"p95Ns\": " << result.p95Ns
+            << ", \"stdDevNs\": " << result.stdDevNs
+            << ", \"allocations\": " << result.allocations << "}";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+bool PerfReport::writeJson(const std::string& fileName) const {
+    std::ofstream file(fileName);
+    if (!file) {
+        return false;
+    }
+    file << toJson();
+    return static_cast<bool>(file);
+}
+
+}
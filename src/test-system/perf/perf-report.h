@@ -0,0 +1,98 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace QaplaPerf {
+
+/**
+ * @brief Summary of one Catch2 benchmark, all times in nanoseconds per iteration.
+ */
+struct BenchmarkResult {
+    std::string testCase;   ///< Name of the test case containing the benchmark
+    std::string name;       ///< Name of the benchmark
+    uint64_t samples = 0;   ///< Number of measured samples
+    uint64_t iterations = 0; ///< Iterations per sample
+    double meanNs = 0.0;
+    double medianNs = 0.0;
+    double p95Ns = 0.0;
+    double stdDevNs = 0.0;
+    double allocations = 0.0; ///< Average heap allocations per iteration
+
+    /**
+     * @brief Unique key of the benchmark, "<test case>/<benchmark>".
+     */
+    [[nodiscard]] std::string key() const {
+        return testCase + "/" + name;
+    }
+};
+
+/**
+ * @brief Collects benchmark results of a perf-tests run and writes them as JSON.
+ */
+class PerfReport {
+public:
+    static PerfReport& instance();
+
+    /**
+     * @brief Builds a result from the per iteration sample times of a benchmark.
+     * @param testCase Name of the test case.
+     * @param name Name of the benchmark.
+     * @param samplesNs Per iteration time of each sample in nanoseconds.
+     * @param iterations Iterations per sample.
+     */
+    static BenchmarkResult summarize(const std::string& testCase, const std::string& name,
+        std::vector<double> samplesNs, uint64_t iterations);
+
+    /**
+     * @brief Nearest rank percentile of sorted values.
+     * @param sorted Values in ascending order.
+     * @param percent Percentile in [0, 100].
+     * @return The percentile, 0 for an empty input.
+     */
+    static double percentile(const std::vector<double>& sorted, double percent);
+
+    void add(BenchmarkResult result) {
+        results_.push_back(std::move(result));
+    }
+
+    [[nodiscard]] const std::vector<BenchmarkResult>& results() const {
+        return results_;
+    }
+
+    /**
+     * @brief Renders all results as a JSON document.
+     */
+    [[nodiscard]] std::string toJson() const;
+
+    /**
+     * @brief Writes the JSON document to a file.
+     * @return False, if the file could not be written.
+     */
+    bool writeJson(const std::string& fileName) const;
+
+private:
+    std::vector<BenchmarkResult> results_;
+};
+
+}
@@ -0,0 +1,245 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "game-manager-pool-access.h"
+#include "game-record-manager.h"
+#include "os-helpers.h"
+#include "perf-helpers.h"
+#include "perf-report.h"
+
+#include <config/engine-global-config.h>
+#include <config/pgn-config.h>
+#include <engine-handling/engine-config.h>
+#include <game-manager/game-manager-pool.h>
+#include <opening/pgn-save.h>
+#include <tournament/tournament.h>
+#include <tournament/tournament-config.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace QaplaTester;
+using QaplaHelpers::OsHelpers;
+using QaplaPerf::PerfReport;
+
+namespace {
+    constexpr size_t ENGINE_COUNT = 4;
+    constexpr size_t PAIR_COUNT = ENGINE_COUNT * (ENGINE_COUNT - 1) / 2;
+    constexpr uint32_t GAMES_PER_CONCURRENT_GAME = 4;
+    constexpr auto POLL_INTERVAL = std::chrono::milliseconds(10);
+    constexpr auto START_GRACE_TIME = std::chrono::seconds(10);
+    constexpr auto LEVEL_TIMEOUT = std::chrono::minutes(10);
+
+    /**
+     * @brief Result of the round robin at one concurrency level.
+     */
+    struct LevelResult {
+        uint32_t concurrency = 0;
+        size_t games = 0;
+        size_t moves = 0;
+        double seconds = 0.0;
+        uint64_t cpuUs = 0;     ///< CPU time of this process, the engines are not included
+        bool finished = false;
+
+        [[nodiscard]] double gamesPerSecond() const {
+            return seconds > 0.0 ? static_cast<double>(games) / seconds : 0.0;
+        }
+        [[nodiscard]] double movesPerSecond() const {
+            return seconds > 0.0 ? static_cast<double>(moves) / seconds : 0.0;
+        }
+        /**
+         * The engine answers instantly, so the time a game slot waits for a move is the round 
+         * trip through the pool: scheduling, pipes, move parsing and the clock handling.
+         */
+        [[nodiscard]] double microsecondsPerMove() const {
+            return moves > 0 ? seconds * 1e6 * concurrency / static_cast<double>(moves) : 0.0;
+        }
+        [[nodiscard]] double cpuMsPerGame() const {
+            return games > 0 ? static_cast<double>(cpuUs) / 1000.0 / static_cast<double>(games) : 0.0;
+        }
+    };
+
+    std::string instantEnginePath() {
+        const auto& options = QaplaPerf::throughputOptions();
+        if (!options.engine.empty()) {
+            return options.engine;
+        }
+#ifdef _WIN32
+        return QaplaPerf::binaryPath("bin/diagnostic-engine-instant.exe");
+#else
+        return QaplaPerf::binaryPath("bin/diagnostic-engine-instant");
+#endif
+    }
+
+    std::vector<EngineConfig> instantEngines(const std::string& path) {
+        EngineGlobalConfig global;
+        // Generous time control, the engine never uses it, a forfeit would only hide overhead
+        global.timeControl = "60+1";
+        std::vector<EngineConfig> engines;
+        for (size_t i = 0; i < ENGINE_COUNT; ++i) {
+            auto config = EngineConfig::createFromPath(path);
+            config.setName(std::format("Instant {}", i + 1));
+            EngineGlobalConfigFile::applyGlobalConfig(config, global);
+            engines.push_back(std::move(config));
+        }
+        return engines;
+    }
+
+    TournamentConfig roundRobinConfig(uint32_t concurrency) {
+        auto games = std::max(QaplaPerf::throughputOptions().minGames, concurrency * GAMES_PER_CONCURRENT_GAME);
+        auto gamesPerPair = static_cast<uint32_t>((games + PAIR_COUNT - 1) / PAIR_COUNT);
+        gamesPerPair += gamesPerPair % 2;
+        return TournamentConfig{
+            .event = std::format("Pool throughput {}", concurrency),
+            .type = "round-robin",
+            .tournamentFilename = "",
+            .games = gamesPerPair,
+            .rounds = 1,
+            .repeat = 1,
+            .openings = Openings{
+                .file = QaplaPerf::sourcePath("test/Noomen.pgn")
+            }
+        };
+    }
+
+    /**
+     * @brief Counts the games and plies written to the PGN file.
+     */
+    std::pair<size_t, size_t> countGames(const std::string& pgnFile) {
+        QaplaWindows::GameRecordManager manager;
+        manager.load(pgnFile);
+        size_t moves = 0;
+        for (const auto& game : manager.getGames()) {
+            moves += game.history().size();
+        }
+        return { manager.getGames().size(), moves };
+    }
+
+    /**
+     * @brief Plays a round robin of instant engines in a fresh pool with the given concurrency.
+     */
+    LevelResult runLevel(const std::vector<EngineConfig>& engines, uint32_t concurrency) {
+        auto pgnFile = (std::filesystem::temp_directory_path() 
+            / std::format("qapla-perf-throughput-{}.pgn", concurrency)).string();
+        std::filesystem::remove(pgnFile);
+        PgnConfig pgnOptions;
+        pgnOptions.file = pgnFile;
+        PgnSave::tournament().setOptions(pgnOptions);
+
+        GameManagerPoolAccess pool(std::make_shared<GameManagerPool>());
+        Tournament tournament;
+        tournament.createTournament(engines, roundRobinConfig(concurrency));
+        pool->clearAll();
+        tournament.scheduleAll(0, false, *pool);
+
+        LevelResult result{ .concurrency = concurrency };
+        const auto cpuStart = OsHelpers::getProcessCpuTimeUs();
+        const auto start = std::chrono::steady_clock::now();
+        pool->setConcurrency(concurrency, true, true);
+
+        bool started = false;
+        while (true) {
+            std::this_thread::sleep_for(POLL_INTERVAL);
+            auto now = std::chrono::steady_clock::now();
+            started = started || pool->runningGameCount() > 0;
+            if (pool->runningGameCount() == 0 
+                && (started || now - start > START_GRACE_TIME) && pool->areAllTasksFinished()) {
+                result.finished = started;
+                break;
+            }
+            if (now - start > LEVEL_TIMEOUT) {
+                break;
+            }
+        }
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const auto cpuEnd = OsHelpers::getProcessCpuTimeUs();
+        if (cpuStart && cpuEnd) {
+            result.cpuUs = *cpuEnd - *cpuStart;
+        }
+
+        pool->stopAll();
+        pool->waitForTask();
+        std::tie(result.games, result.moves) = countGames(pgnFile);
+        std::filesystem::remove(pgnFile);
+        return result;
+    }
+
+    std::vector<uint32_t> concurrencyLevels(uint32_t maximum) {
+        std::vector<uint32_t> levels;
+        for (uint32_t level = 1; level < maximum; level *= 2) {
+            levels.push_back(level);
+        }
+        levels.push_back(std::max(1U, maximum));
+        return levels;
+    }
+
+    void printTable(const std::vector<LevelResult>& results) {
+        std::cout << std::format("\n{:>11} {:>6} {:>8} {:>9} {:>10} {:>11} {:>12}\n",
+            "concurrency", "games", "moves", "games/s", "moves/s", "us/move", "CPU ms/game");
+        for (const auto& result : results) {
+            std::cout << std::format("{:>11} {:>6} {:>8} {:>9.2f} {:>10.0f} {:>11.1f} {:>12.2f}{}\n",
+                result.concurrency, result.games, result.moves, result.gamesPerSecond(),
+                result.movesPerSecond(), result.microsecondsPerMove(), result.cpuMsPerGame(),
+                result.finished ? "" : " (timeout)");
+        }
+    }
+
+    /**
+     * @brief Adds the per move and per game costs to the report, so that they are part of
+     * the JSON summary and the baseline comparison.
+     */
+    void addToReport(const LevelResult& result) {
+        const std::string testCase = "Pool throughput";
+        auto perMove = PerfReport::summarize(testCase, std::format("concurrency {}: time per move", result.concurrency),
+            { result.microsecondsPerMove() * 1000.0 }, result.moves);
+        PerfReport::instance().add(std::move(perMove));
+        auto cpuPerGame = PerfReport::summarize(testCase, std::format("concurrency {}: CPU per game", result.concurrency),
+            { result.cpuMsPerGame() * 1e6 }, result.games);
+        PerfReport::instance().add(std::move(cpuPerGame));
+    }
+}
+
+TEST_CASE("Pool throughput with instant engines", "[.][throughput]") {
+    auto enginePath = instantEnginePath();
+    if (!std::filesystem::exists(enginePath)) {
+        WARN("Instant engine not found: " << enginePath);
+        return;
+    }
+    auto engines = instantEngines(enginePath);
+
+    std::vector<LevelResult> results;
+    for (auto concurrency : concurrencyLevels(QaplaPerf::throughputOptions().maxConcurrency)) {
+        auto result = runLevel(engines, concurrency);
+        CHECK(result.finished);
+        CHECK(result.games > 0);
+        addToReport(result);
+        results.push_back(result);
+    }
+    printTable(results);
+}
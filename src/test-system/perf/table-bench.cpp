@@ -0,0 +1,113 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "table-index.h"
+#include "imgui-table.h"
+#include "natural-sort.h"
+#include "perf-allocations.h"
+
+#include <string>
+#include <vector>
+
+using namespace QaplaWindows;
+
+namespace {
+    constexpr size_t ROW_COUNT = 100000;
+
+    std::vector<std::vector<std::string>> syntheticRows() {
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(ROW_COUNT);
+        for (size_t i = 0; i < ROW_COUNT; ++i) {
+            // Scatter the numbers so that sorting does real work
+            size_t value = (i * 7919) % ROW_COUNT;
+            rows.push_back({ 
+                std::to_string(i + 1), 
+                "Engine " + std::to_string(value % 97), 
+                "Engine " + std::to_string(value % 89),
+                value % 3 == 0 ? "1-0" : (value % 3 == 1 ? "1/2-1/2" : "0-1"),
+                std::to_string(value) + " moves"
+            });
+        }
+        return rows;
+    }
+}
+
+TEST_CASE("TableIndex sort and filter", "[perf][table]") {
+    auto rows = syntheticRows();
+    std::vector<std::string> keys;
+    keys.reserve(rows.size());
+    for (const auto& row : rows) {
+        keys.push_back(naturalSortKey(row[4]));
+    }
+
+    BENCHMARK("natural sort keys") {
+        QaplaPerf::AllocationScope allocations;
+        std::vector<std::string> computed;
+        computed.reserve(rows.size());
+        for (const auto& row : rows) {
+            computed.push_back(naturalSortKey(row[4]));
+        }
+        return computed.size();
+    };
+
+    BENCHMARK("sortByKeys") {
+        QaplaPerf::AllocationScope allocations;
+        TableIndex index;
+        index.updateSize(rows.size());
+        index.sortByKeys(keys, true);
+        return index.size();
+    };
+
+    BENCHMARK("sort with natural compare") {
+        QaplaPerf::AllocationScope allocations;
+        TableIndex index;
+        index.updateSize(rows.size());
+        index.sort([&rows](size_t a, size_t b) { return naturalCompare(rows[a][1], rows[b][1]); });
+        return index.size();
+    };
+
+    BENCHMARK("filter") {
+        QaplaPerf::AllocationScope allocations;
+        TableIndex index;
+        index.updateSize(rows.size());
+        index.filter([&rows](size_t row) { return rows[row][3] == "1-0"; });
+        return index.size();
+    };
+}
+
+TEST_CASE("ImGuiTable population", "[perf][table]") {
+    auto rows = syntheticRows();
+
+    BENCHMARK("push rows") {
+        QaplaPerf::AllocationScope allocations;
+        ImGuiTable table("Perf", 0, {
+            { .name = "Nr", .alignRight = true },
+            { .name = "White" },
+            { .name = "Black" },
+            { .name = "Result" },
+            { .name = "Length" }
+        });
+        for (const auto& row : rows) {
+            table.push(row);
+        }
+        return table.size();
+    };
+}
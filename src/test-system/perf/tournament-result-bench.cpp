@@ -0,0 +1,100 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "test-system/unit/unit-test-helpers.h"
+#include "test-system/unit/tournament-test-helpers.h"
+#include <tournament/tournament.h>
+#include "tournament-result-incremental.h"
+#include "perf-helpers.h"
+#include "perf-allocations.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace QaplaTester;
+using namespace QaplaTester::Test;
+using namespace QaplaWindows;
+
+namespace {
+    constexpr size_t ENGINE_COUNT = 16;
+    constexpr uint32_t GAMES_PER_PAIR = 40;
+
+    TournamentConfig roundRobinConfig() {
+        return TournamentConfig{
+            .event = "Perf Round Robin",
+            .type = "round-robin",
+            .tournamentFilename = "",
+            .games = GAMES_PER_PAIR,
+            .rounds = 1,
+            .repeat = 1,
+            .openings = Openings{
+                .file = QaplaPerf::sourcePath("src/test-system/unit/test-openings.pgn"),
+                .plies = 1
+            }
+        };
+    }
+
+    auto roundRobinEngines() {
+        std::vector<TestEngineParams> params;
+        for (size_t i = 0; i < ENGINE_COUNT; ++i) {
+            params.push_back({ .name = "Engine" + std::to_string(i + 1) });
+        }
+        return createEngines(params);
+    }
+
+    /**
+     * @brief Plays every pair tournament halfway, and every second one completely,
+     * so that the incremental result has finished and running pairs to handle.
+     */
+    void playHalfTournament(TournamentBuilder& builder) {
+        constexpr std::array<GameResult, 3> results{ 
+            GameResult::WhiteWins, GameResult::Draw, GameResult::BlackWins };
+        for (size_t pair = 0; pair < builder.pairTournamentCount(); ++pair) {
+            uint32_t games = pair % 2 == 0 ? GAMES_PER_PAIR : GAMES_PER_PAIR / 2;
+            std::vector<GameResult> played;
+            for (uint32_t game = 0; game < games; ++game) {
+                played.push_back(results[(pair + game) % results.size()]);
+            }
+            builder.playGames(pair, played);
+        }
+    }
+}
+
+TEST_CASE("TournamentResultIncremental poll", "[perf][tournament-result]") {
+    auto engines = roundRobinEngines();
+    TournamentBuilder builder(engines, roundRobinConfig());
+    playHalfTournament(builder);
+
+    BENCHMARK("first poll of a running round robin") {
+        QaplaPerf::AllocationScope allocations;
+        TournamentResultIncremental incremental;
+        incremental.poll(builder.tournament, 2600.0);
+        return incremental.getPlayedGames();
+    };
+
+    TournamentResultIncremental incremental;
+    incremental.poll(builder.tournament, 2600.0);
+    BENCHMARK("unchanged poll") {
+        QaplaPerf::AllocationScope allocations;
+        return incremental.poll(builder.tournament, 2600.0);
+    };
+}
@@ -20,6 +20,7 @@
 #include "test-system/test-manager.h"
 #include "test-system/regression-tests.h"
 #include "test-system/epd-chatbot-tests.h"
+#include "test-system/frame-time-tests.h"
 #include "test-system/tournament-chatbot/tournament-chatbot-tests.h"
 #include "test-system/sprt-tournament-chatbot/sprt-tournament-chatbot-tests.h"
 #include "test-system/tutorial-test/tournament/tutorial-tests.h"
@@ -73,6 +74,7 @@ namespace QaplaTest {
         registerEpdTutorialTests(engine_);
         registerEngineSetupTutorialTests(engine_);
         registerBoardWindowTutorialTests(engine_);
+        registerFrameTimeTests(engine_);
 #endif
     }
 
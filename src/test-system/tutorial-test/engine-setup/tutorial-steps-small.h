@@ -69,16 +69,16 @@ namespace QaplaTest::EngineSetupTutorialTest {
         ctx->Yield();
 
         // Wait for detection to complete
-        auto& capabilities = QaplaConfiguration::Configuration::instance().getEngineCapabilities();
+        auto& detection = QaplaWindows::EngineFingerprintCache::instance();
         float waited = 0.0f;
         constexpr float sleepInterval = 0.5f;
         constexpr float maxWait = 30.0f;
-        while (capabilities.isDetecting() && waited < maxWait) {
+        while (detection.isDetecting() && waited < maxWait) {
             ctx->SleepNoSkip(sleepInterval, sleepInterval);
             waited += sleepInterval;
         }
         
-        if (capabilities.isDetecting()) {
+        if (detection.isDetecting()) {
             IM_ERRORF("Detection did not complete within %.1f seconds", maxWait);
             return;
         }
@@ -136,16 +136,16 @@ namespace QaplaTest::EngineSetupTutorialTest {
         ctx->Yield();
 
         // Wait for detection to complete
-        auto& capabilities = QaplaConfiguration::Configuration::instance().getEngineCapabilities();
+        auto& detection = QaplaWindows::EngineFingerprintCache::instance();
         float waited = 0.0f;
         constexpr float sleepInterval = 0.5f;
         constexpr float maxWait = 30.0f;
-        while (capabilities.isDetecting() && waited < maxWait) {
+        while (detection.isDetecting() && waited < maxWait) {
             ctx->SleepNoSkip(sleepInterval, sleepInterval);
             waited += sleepInterval;
         }
         
-        if (capabilities.isDetecting()) {
+        if (detection.isDetecting()) {
             IM_ERRORF("Detection did not complete within %.1f seconds", maxWait);
             return;
         }
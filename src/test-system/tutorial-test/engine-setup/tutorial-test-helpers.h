@@ -24,6 +24,7 @@
 #include "../tutorial-test-common.h"
 #include "engine-setup-window.h"
 #include "configuration.h"
+#include "engine-fingerprint-cache.h"
 #include "imgui-engine-select.h"
 #include "chatbot/chatbot-window.h"
 
@@ -102,8 +103,7 @@ namespace QaplaTest::EngineSetupTutorialTest {
      */
     inline bool waitForDetectionComplete(ImGuiTestContext* ctx, float maxWaitSeconds = 20.0f) {
         return waitForCondition(ctx, []() {
-            auto& capabilities = QaplaConfiguration::Configuration::instance().getEngineCapabilities();
-            return !capabilities.isDetecting();
+            return !QaplaWindows::EngineFingerprintCache::instance().isDetecting();
         }, maxWaitSeconds);
     }
 
@@ -0,0 +1,65 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "adaptive-concurrency.h"
+
+using QaplaWindows::AdaptiveConcurrency;
+using Measurement = AdaptiveConcurrency::Measurement;
+
+TEST_CASE("AdaptiveConcurrency raises concurrency with CPU headroom", "[adaptive-concurrency]") {
+    REQUIRE(AdaptiveConcurrency::decide(4, 64, Measurement{ .cpuLoad = 0.5 }) == 5);
+    REQUIRE(AdaptiveConcurrency::decide(32, 64, Measurement{ .cpuLoad = 0.5 }) == 36);
+    REQUIRE(AdaptiveConcurrency::decide(62, 64, Measurement{ .cpuLoad = 0.5 }) == 64);
+    REQUIRE(AdaptiveConcurrency::decide(64, 64, Measurement{ .cpuLoad = 0.5 }) == 64);
+}
+
+TEST_CASE("AdaptiveConcurrency holds on saturated or unknown CPU load", "[adaptive-concurrency]") {
+    REQUIRE(AdaptiveConcurrency::decide(16, 64, Measurement{ .cpuLoad = 0.95 }) == 16);
+    REQUIRE(AdaptiveConcurrency::decide(16, 64, Measurement{}) == 16);
+    REQUIRE(AdaptiveConcurrency::decide(80, 64, Measurement{}) == 64);
+}
+
+TEST_CASE("AdaptiveConcurrency backs off on time forfeits", "[adaptive-concurrency]") {
+    REQUIRE(AdaptiveConcurrency::decide(16, 64, Measurement{ .cpuLoad = 0.5, .games = 5, .forfeits = 3 }) == 12);
+    REQUIRE(AdaptiveConcurrency::decide(16, 64, Measurement{ .cpuLoad = 0.5, .games = 100, .forfeits = 3 }) == 12);
+    REQUIRE(AdaptiveConcurrency::decide(16, 64, Measurement{ .cpuLoad = 0.5, .games = 20, .forfeits = 1 }) == 12);
+    // A single forfeit in few games stops raising, but does not reduce
+    REQUIRE(AdaptiveConcurrency::decide(16, 64, Measurement{ .cpuLoad = 0.5, .games = 5, .forfeits = 1 }) == 16);
+    REQUIRE(AdaptiveConcurrency::decide(1, 64, Measurement{ .cpuLoad = 0.5, .games = 5, .forfeits = 3 }) == 1);
+}
+
+TEST_CASE("AdaptiveConcurrency backs off on move time overshoots", "[adaptive-concurrency]") {
+    REQUIRE(AdaptiveConcurrency::decide(8, 64, Measurement{ .cpuLoad = 0.5, .moves = 100, .overshoots = 10 }) == 6);
+    // Too few moves to judge
+    REQUIRE(AdaptiveConcurrency::decide(8, 64, Measurement{ .cpuLoad = 0.95, .moves = 20, .overshoots = 10 }) == 8);
+    REQUIRE(AdaptiveConcurrency::decide(8, 64, Measurement{ .cpuLoad = 0.5, .moves = 1000, .overshoots = 5 }) == 9);
+}
+
+TEST_CASE("AdaptiveConcurrency rates clock moves against the clock left", "[adaptive-concurrency]") {
+    // A normal move of a 60+1 game
+    REQUIRE_FALSE(AdaptiveConcurrency::isClockOvershoot(2000, 50000, 1000));
+    // Low on time, living from the increment
+    REQUIRE_FALSE(AdaptiveConcurrency::isClockOvershoot(900, 300, 1000));
+    // A move spending most of the clock
+    REQUIRE(AdaptiveConcurrency::isClockOvershoot(6000, 4000, 1000));
+    REQUIRE(AdaptiveConcurrency::isClockOvershoot(1200, 100, 0));
+    REQUIRE(AdaptiveConcurrency::isClockOvershoot(500, -20, 0));
+}
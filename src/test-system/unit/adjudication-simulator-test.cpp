@@ -0,0 +1,114 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "adjudication-simulator.h"
+
+#include <optional>
+#include <vector>
+
+using QaplaTester::GameResult;
+using QaplaWindows::AdjudicationSimulator;
+
+namespace {
+    AdjudicationSimulator::GameEvals makeGame(const std::vector<std::optional<int>>& scores, GameResult result) {
+        AdjudicationSimulator::GameEvals game;
+        game.scores = scores;
+        game.timesMs.assign(scores.size(), 1000);
+        game.result = result;
+        return game;
+    }
+}
+
+TEST_CASE("AdjudicationSimulator draw rule", "[adjudication-simulator]") {
+    // Eight plies within the threshold, starting at ply 2
+    auto game = makeGame({ 50, -40, 5, -5, 0, 3, -2, 1, 0, 0, 9, -9 }, GameResult::Draw);
+
+    SECTION("triggers after the required number of move pairs") {
+        auto ply = AdjudicationSimulator::drawPly(game, { .centipawnThreshold = 10, .requiredConsecutiveMoves = 4, .minFullMoves = 0 });
+        REQUIRE(ply.has_value());
+        CHECK(*ply == 9);
+    }
+
+    SECTION("waits for the minimal full move") {
+        auto ply = AdjudicationSimulator::drawPly(game, { .centipawnThreshold = 10, .requiredConsecutiveMoves = 4, .minFullMoves = 6 });
+        REQUIRE(ply.has_value());
+        CHECK(*ply == 10);
+    }
+
+    SECTION("missing evaluations reset the count") {
+        game.scores[5] = std::nullopt;
+        CHECK_FALSE(AdjudicationSimulator::drawPly(game, { .centipawnThreshold = 10, .requiredConsecutiveMoves = 4, .minFullMoves = 0 }).has_value());
+    }
+}
+
+TEST_CASE("AdjudicationSimulator resign rule", "[adjudication-simulator]") {
+    // Black evaluates its position as lost from ply 3 on, white agrees from ply 6 on
+    auto game = makeGame({ 20, -30, 100, -600, 300, -700, 700, -800, 800, -900, 900 }, GameResult::WhiteWins);
+    AdjudicationSimulator::Setting setting{ .centipawnThreshold = 500, .requiredConsecutiveMoves = 3, .minFullMoves = 0 };
+
+    auto oneSided = AdjudicationSimulator::resignPly(game, setting, false);
+    REQUIRE(oneSided.has_value());
+    CHECK(oneSided->first == 7);
+    CHECK(oneSided->second == GameResult::WhiteWins);
+
+    auto twoSided = AdjudicationSimulator::resignPly(game, setting, true);
+    REQUIRE(twoSided.has_value());
+    CHECK(twoSided->first == 10);
+
+    game.whiteStarts = false;
+    auto blackFirst = AdjudicationSimulator::resignPly(game, setting, false);
+    REQUIRE(blackFirst.has_value());
+    CHECK(blackFirst->second == GameResult::BlackWins);
+}
+
+TEST_CASE("AdjudicationSimulator simulates a grid in parallel", "[adjudication-simulator]") {
+    std::vector<AdjudicationSimulator::GameEvals> games;
+    for (int index = 0; index < 50; ++index) {
+        games.push_back(makeGame({ 0, 0, 0, 0, 0, 0 }, index % 5 == 0 ? GameResult::WhiteWins : GameResult::Draw));
+    }
+    AdjudicationSimulator::Grid grid{
+        .drawThresholds = { 10 },
+        .resignThresholds = { 500 },
+        .consecutiveMoves = { 1, 2 },
+        .minFullMoves = { 0 },
+        .twoSidedResign = false
+    };
+    auto rows = grid.rows();
+    REQUIRE(rows.size() == 4);
+    AdjudicationSimulator::simulate(games, rows, grid.twoSidedResign, 4);
+
+    const auto& draw = rows[0].outcome;
+    CHECK(draw.total == 50);
+    CHECK(draw.correct == 40);
+    CHECK(draw.incorrect == 10);
+    CHECK(draw.savedMs == 50 * 4000);
+    CHECK(draw.totalMs == 50 * 6000);
+
+    CHECK(rows[1].outcome.savedMs == 50 * 2000);
+    CHECK(rows[2].rule == AdjudicationSimulator::Rule::Resign);
+    CHECK(rows[2].outcome.total == 0);
+}
+
+TEST_CASE("AdjudicationSimulator parses value lists", "[adjudication-simulator]") {
+    const std::vector<int> expected{ 5, 10, 20, -3 };
+    CHECK(AdjudicationSimulator::parseList("5, 10,20 ; 10 x -3") == expected);
+    CHECK(AdjudicationSimulator::parseList("").empty());
+}
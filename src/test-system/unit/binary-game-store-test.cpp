@@ -0,0 +1,108 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "binary-game-store.h"
+
+#include <opening/pgn-io.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace QaplaWindows;
+using QaplaTester::PgnIO;
+
+TEST_CASE("BinaryMoveCodec roundtrips all move codes", "[binary-game-store]") {
+    REQUIRE(BinaryMoveCodec::encode("a1a2") == uint16_t(8 << 6));
+    REQUIRE(BinaryMoveCodec::decode(*BinaryMoveCodec::encode("e7e8q")) == "e7e8q");
+    REQUIRE_FALSE(BinaryMoveCodec::encode("e7e8k").has_value());
+    REQUIRE_FALSE(BinaryMoveCodec::encode("e2e9").has_value());
+    REQUIRE_FALSE(BinaryMoveCodec::encode("O-O").has_value());
+
+    bool allRoundtrip = true;
+    for (uint16_t code = 0; code < (5 << 12); ++code) {
+        auto encoded = BinaryMoveCodec::encode(BinaryMoveCodec::decode(code));
+        allRoundtrip = allRoundtrip && encoded == code;
+    }
+    REQUIRE(allRoundtrip);
+}
+
+TEST_CASE("BinaryGameReader loads games converted from PGN", "[binary-game-store]") {
+    const std::string inputFile = "test/Noomen.pgn";
+    const auto binaryFile = (std::filesystem::temp_directory_path() / "qapla-store-test.qgb").string();
+
+    PgnIO pgnIO;
+    auto pgnGames = pgnIO.loadGames(inputFile, true, nullptr);
+    REQUIRE_FALSE(pgnGames.empty());
+
+    auto converted = BinaryGameReader::convertPgn(inputFile, binaryFile);
+    REQUIRE(converted == pgnGames.size());
+    REQUIRE(BinaryGameReader::isBinaryGameFile(binaryFile));
+
+    BinaryGameReader reader;
+    auto games = reader.load(binaryFile);
+    REQUIRE(games.size() == pgnGames.size());
+    for (size_t i = 0; i < games.size(); ++i) {
+        REQUIRE(games[i].getTags() == pgnGames[i].getTags());
+        REQUIRE(games[i].getGameResult().second == pgnGames[i].getGameResult().second);
+        REQUIRE(games[i].getStartFen() == pgnGames[i].getStartFen());
+        REQUIRE(games[i].history().size() == pgnGames[i].history().size());
+    }
+
+    for (size_t index = 0; index < games.size(); ++index) {
+        auto game = reader.loadGameAtIndex(index);
+        REQUIRE(game.has_value());
+        const auto pgnGame = pgnIO.loadGameAtIndex(index);
+        REQUIRE(pgnGame.has_value());
+        REQUIRE(game->getTags() == pgnGame->getTags());
+        REQUIRE(game->getGameResult().second == pgnGame->getGameResult().second);
+        REQUIRE(game->history().size() == pgnGame->history().size());
+        for (size_t i = 0; i < game->history().size(); ++i) {
+            const auto& move = game->history()[i];
+            const auto& pgnMove = pgnGame->history()[i];
+            REQUIRE(move.san_ == pgnMove.san_);
+            REQUIRE(games[index].history()[i].lan_ == move.lan_);
+            REQUIRE(move.timeMs == pgnMove.timeMs);
+            REQUIRE(move.scoreCp == pgnMove.scoreCp);
+            REQUIRE(move.scoreMate == pgnMove.scoreMate);
+            REQUIRE(move.depth == pgnMove.depth);
+        }
+    }
+    REQUIRE_FALSE(reader.loadGameAtIndex(games.size()).has_value());
+    std::filesystem::remove(binaryFile);
+}
+
+TEST_CASE("BinaryGameReader rejects game counts exceeding the file size", "[binary-game-store]") {
+    const auto binaryFile = (std::filesystem::temp_directory_path() / "qapla-store-corrupt.qgb").string();
+    {
+        std::ofstream out(binaryFile, std::ios::binary);
+        // Header, trailer with an empty dictionary and one block claiming 0xFFFFFFFF games, footer
+        const std::string content = std::string("QGB1\x01\0\0\0", 8)
+            + std::string("\0\x01\x08\0\0\0\0\0\0\0\xff\xff\xff\xff", 14)
+            + std::string("\x08\0\0\0\0\0\0\0QGBE", 12);
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    BinaryGameReader reader;
+    REQUIRE_THROWS_AS(reader.load(binaryFile), std::runtime_error);
+    std::filesystem::remove(binaryFile);
+}
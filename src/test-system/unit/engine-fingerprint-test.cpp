@@ -0,0 +1,116 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "engine-fingerprint.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using QaplaWindows::EngineFingerprint;
+
+namespace {
+    void writeFile(const std::filesystem::path& path, const std::string& content) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << content;
+    }
+
+    void shiftModificationTime(const std::filesystem::path& path) {
+        auto time = std::filesystem::last_write_time(path);
+        std::filesystem::last_write_time(path, time + std::chrono::seconds(10));
+    }
+}
+
+TEST_CASE("EngineFingerprint detects rebuilt executables", "[engine-fingerprint]") {
+    auto path = std::filesystem::temp_directory_path() / "qapla-fingerprint-test.bin";
+    writeFile(path, "engine build one");
+
+    auto stored = EngineFingerprint::compute(path.string());
+    REQUIRE(stored.has_value());
+    CHECK(stored->size == 16);
+
+    std::optional<EngineFingerprint> current;
+    CHECK(stored->check(current) == EngineFingerprint::Status::Unchanged);
+    CHECK_FALSE(current.has_value());
+
+    SECTION("same content with a new modification time") {
+        shiftModificationTime(path);
+        CHECK(stored->check(current) == EngineFingerprint::Status::Touched);
+        REQUIRE(current.has_value());
+        CHECK(current->hash == stored->hash);
+        CHECK(current->modified != stored->modified);
+    }
+
+    SECTION("same size with different content") {
+        writeFile(path, "engine build two");
+        shiftModificationTime(path);
+        CHECK(stored->check(current) == EngineFingerprint::Status::Changed);
+    }
+
+    SECTION("removed executable") {
+        std::filesystem::remove(path);
+        CHECK(stored->check(current) == EngineFingerprint::Status::Changed);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EngineFingerprint of a missing file is empty", "[engine-fingerprint]") {
+    CHECK_FALSE(EngineFingerprint::compute("/nonexistent/qapla-engine").has_value());
+}
+
+TEST_CASE("EngineFingerprint::checkAll selects the capabilities to invalidate", "[engine-fingerprint]") {
+    const auto dir = std::filesystem::temp_directory_path() / "qapla-fingerprint-check";
+    std::filesystem::create_directories(dir);
+    const auto unchanged = dir / "unchanged";
+    const auto touched = dir / "touched";
+    const auto rebuilt = dir / "rebuilt";
+    const auto removed = dir / "removed";
+    const auto added = dir / "added";
+    for (const auto& path : { unchanged, touched, rebuilt, removed, added }) {
+        writeFile(path, "engine " + path.filename().string());
+    }
+    std::vector<EngineFingerprint> known;
+    for (const auto& path : { unchanged, touched, rebuilt, removed }) {
+        auto fingerprint = EngineFingerprint::compute(path.string());
+        REQUIRE(fingerprint.has_value());
+        known.push_back(*fingerprint);
+    }
+
+    shiftModificationTime(touched);
+    writeFile(rebuilt, "engine REBUILT");
+    shiftModificationTime(rebuilt);
+    std::filesystem::remove(removed);
+
+    auto result = EngineFingerprint::checkAll(known, { added.string(), (dir / "missing").string() });
+
+    std::vector<std::string> expectedChanged{ rebuilt.string(), removed.string() };
+    CHECK(result.changed == expectedChanged);
+    REQUIRE(result.fingerprints.size() == 2);
+    CHECK(result.fingerprints[0].path == touched.string());
+    CHECK(result.fingerprints[0].hash == known[1].hash);
+    CHECK(result.fingerprints[0].modified != known[1].modified);
+    CHECK(result.fingerprints[1] == EngineFingerprint::compute(added.string()));
+
+    std::filesystem::remove_all(dir);
+}
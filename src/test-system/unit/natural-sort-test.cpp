@@ -0,0 +1,98 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "natural-sort.h"
+#include "table-index.h"
+
+#include <string>
+#include <vector>
+
+using namespace QaplaWindows;
+
+TEST_CASE("Natural sort keys preserve natural ordering", "[natural-sort]") {
+    const std::vector<std::string> values = {
+        "", "0", "00", "1", "01", "2", "10", "100", "a", "a1", "a01", "a2", "a10",
+        "a10b", "a10 b", "b", "B", "Player 9", "Player 10", "Player 010", "-5", "1.5",
+        "1.10", "\xc3\xa4", std::string(300, '9'), std::string(254, '9')
+    };
+
+    for (const auto& a : values) {
+        for (const auto& b : values) {
+            INFO("a = '" << a << "', b = '" << b << "'");
+            REQUIRE(naturalCompare(a, b) == (naturalSortKey(a) < naturalSortKey(b)));
+        }
+    }
+}
+
+TEST_CASE("Natural sort orders bytes independent of char signedness", "[natural-sort]") {
+    REQUIRE(naturalCompare("z", "\xc3\xa4"));
+    REQUIRE_FALSE(naturalCompare("\xc3\xa4", "z"));
+    REQUIRE(naturalSortKey("z") < naturalSortKey("\xc3\xa4"));
+    REQUIRE(naturalSortKey("9") < naturalSortKey("\xc3\xa4"));
+}
+
+TEST_CASE("TableIndex sorts rows by precomputed keys", "[natural-sort][table-index]") {
+    const std::vector<std::string> values = { "10", "2", "1", "2", "100", "0" };
+    std::vector<std::string> keys;
+    for (const auto& value : values) {
+        keys.push_back(naturalSortKey(value));
+    }
+
+    TableIndex index;
+    index.updateSize(values.size());
+
+    SECTION("Ascending keeps row order for equal keys") {
+        index.sortByKeys(keys, true);
+        std::vector<size_t> rows;
+        for (size_t i = 0; i < index.size(); ++i) {
+            rows.push_back(index.getRowNumber(i));
+        }
+        REQUIRE(rows == std::vector<size_t>{ 5, 2, 1, 3, 0, 4 });
+    }
+
+    SECTION("Descending") {
+        index.sortByKeys(keys, false);
+        std::vector<size_t> rows;
+        for (size_t i = 0; i < index.size(); ++i) {
+            rows.push_back(index.getRowNumber(i));
+        }
+        REQUIRE(rows == std::vector<size_t>{ 4, 0, 1, 3, 2, 5 });
+    }
+
+    SECTION("Large tables are sorted in parallel chunks") {
+        constexpr size_t rowCount = 200000;
+        std::vector<std::string> largeKeys;
+        for (size_t row = 0; row < rowCount; ++row) {
+            largeKeys.push_back(naturalSortKey(std::to_string((row * 7919) % 1000)));
+        }
+        TableIndex largeIndex;
+        largeIndex.updateSize(rowCount);
+        largeIndex.sortByKeys(largeKeys, true);
+        REQUIRE(largeIndex.size() == rowCount);
+        bool sorted = true;
+        for (size_t i = 1; i < largeIndex.size(); ++i) {
+            const auto& prev = largeKeys[largeIndex.getRowNumber(i - 1)];
+            const auto& cur = largeKeys[largeIndex.getRowNumber(i)];
+            sorted = sorted && prev <= cur;
+        }
+        REQUIRE(sorted);
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "test-system/perf/perf-baseline.h"
+
+#include <string>
+#include <vector>
+
+using QaplaPerf::BenchmarkResult;
+using QaplaPerf::PerfBaseline;
+using QaplaPerf::PerfReport;
+
+namespace {
+    BenchmarkResult benchmark(const std::string& name, double medianNs, double p95Ns, double allocations) {
+        BenchmarkResult result{ .testCase = "Table", .name = name };
+        result.samples = 100;
+        result.iterations = 1;
+        result.meanNs = medianNs;
+        result.medianNs = medianNs;
+        result.p95Ns = p95Ns;
+        result.allocations = allocations;
+        return result;
+    }
+
+    PerfBaseline::Status statusOf(const std::vector<PerfBaseline::Comparison>& comparisons, 
+        const std::string& key) {
+        for (const auto& comparison : comparisons) {
+            if (comparison.key == key) {
+                return comparison.status;
+            }
+        }
+        FAIL("missing comparison " << key);
+        return PerfBaseline::Status::Missing;
+    }
+}
+
+TEST_CASE("PerfReport summarizes samples", "[perf-baseline]") {
+    std::vector<double> samples{ 5, 1, 3, 2, 4, 100, 6, 7, 8, 9 };
+    auto result = PerfReport::summarize("Table", "sort", samples, 10);
+    CHECK(result.samples == 10);
+    CHECK(result.medianNs == 5.0);
+    CHECK(result.p95Ns == 100.0);
+    CHECK(result.meanNs == 14.5);
+    CHECK(PerfReport::percentile({}, 50.0) == 0.0);
+}
+
+TEST_CASE("PerfBaseline reads the JSON it writes", "[perf-baseline]") {
+    PerfReport report;
+    report.add(benchmark("sort \"quoted\"", 1500.0, 2000.0, 3.0));
+    report.add(benchmark("filter", 250.5, 300.0, 0.0));
+
+    auto parsed = PerfBaseline::parse(report.toJson());
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->size() == 2);
+    CHECK((*parsed)[0].name == "sort \"quoted\"");
+    CHECK((*parsed)[0].testCase == "Table");
+    CHECK((*parsed)[0].allocations == 3.0);
+    CHECK((*parsed)[1].medianNs == 250.5);
+    CHECK((*parsed)[1].samples == 100);
+
+    CHECK(!PerfBaseline::parse("{\"benchmarks\": [{\"name\": }]}").has_value());
+    CHECK(!PerfBaseline::parse("not json").has_value());
+    auto empty = PerfBaseline::parse("{\"benchmarks\": []}");
+    REQUIRE(empty.has_value());
+    CHECK(empty->empty());
+}
+
+TEST_CASE("PerfBaseline compares against tolerances", "[perf-baseline]") {
+    std::vector<BenchmarkResult> baseline{
+        benchmark("sort", 1000.0, 1200.0, 2.0),
+        benchmark("filter", 1000.0, 1200.0, 0.0),
+        benchmark("push", 1000.0, 1200.0, 10.0),
+        benchmark("removed", 1000.0, 1200.0, 0.0)
+    };
+    std::vector<BenchmarkResult> current{
+        benchmark("sort", 1050.0, 1400.0, 2.0),   // within 10 % median and 25 % p95
+        benchmark("filter", 1200.0, 1200.0, 0.0), // median 20 % slower
+        benchmark("push", 1000.0, 1200.0, 12.0),  // 20 % more allocations
+        benchmark("added", 1000.0, 1200.0, 0.0)
+    };
+
+    auto comparisons = PerfBaseline::compare(baseline, current, PerfBaseline::Tolerances{});
+    REQUIRE(comparisons.size() == 5);
+    CHECK(statusOf(comparisons, "Table/sort") == PerfBaseline::Status::Pass);
+    CHECK(statusOf(comparisons, "Table/filter") == PerfBaseline::Status::Fail);
+    CHECK(statusOf(comparisons, "Table/push") == PerfBaseline::Status::Fail);
+    CHECK(statusOf(comparisons, "Table/removed") == PerfBaseline::Status::Missing);
+    CHECK(statusOf(comparisons, "Table/added") == PerfBaseline::Status::New);
+    CHECK(!PerfBaseline::passed(comparisons));
+
+    PerfBaseline::Tolerances loose{ .medianPercent = 50.0, .p95Percent = 50.0, .allocationPercent = 50.0 };
+    CHECK(PerfBaseline::passed(PerfBaseline::compare(baseline, current, loose)));
+
+    auto table = PerfBaseline::formatTable(comparisons);
+    CHECK(table.find("Table/filter") != std::string::npos);
+    CHECK(table.find("+20.0%") != std::string::npos);
+    CHECK(table.find("FAIL") != std::string::npos);
+}
+
+TEST_CASE("PerfBaseline merge keeps benchmarks that were not run", "[perf-baseline]") {
+    std::vector<BenchmarkResult> baseline{ benchmark("sort", 1000.0, 1200.0, 2.0), benchmark("filter", 10.0, 12.0, 0.0) };
+    std::vector<BenchmarkResult> current{ benchmark("sort", 900.0, 1000.0, 1.0), benchmark("push", 5.0, 6.0, 1.0) };
+
+    auto merged = PerfBaseline::merge(baseline, current);
+    REQUIRE(merged.size() == 3);
+    CHECK(merged[0].medianNs == 900.0);
+    CHECK(merged[1].name == "filter");
+    CHECK(merged[2].name == "push");
+    CHECK(PerfBaseline::formatDuration(1500.0) == "1.5 us");
+    CHECK(PerfBaseline::formatDuration(2.5e6) == "2.5 ms");
+}
@@ -0,0 +1,70 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "pgn-merger.h"
+
+#include <filesystem>
+#include <string>
+
+using namespace QaplaWindows;
+
+TEST_CASE("FingerprintSet detects duplicates", "[pgn-merger]") {
+    FingerprintSet set;
+    constexpr uint64_t count = 100000;
+    for (uint64_t value = 0; value < count; ++value) {
+        REQUIRE(set.insert(value * 0x9E3779B97F4A7C15ULL));
+    }
+    REQUIRE(set.size() == count);
+
+    bool anyInserted = false;
+    for (uint64_t value = 0; value < count; ++value) {
+        anyInserted = anyInserted || set.insert(value * 0x9E3779B97F4A7C15ULL);
+    }
+    REQUIRE_FALSE(anyInserted);
+    REQUIRE(set.size() == count);
+
+    set.clear();
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.insert(0));
+    REQUIRE_FALSE(set.insert(0));
+}
+
+TEST_CASE("PgnMerger drops games already merged from another file", "[pgn-merger]") {
+    const std::string inputFile = "test/Noomen.pgn";
+    const auto outputFile = (std::filesystem::temp_directory_path() / "qapla-merge-test.pgn").string();
+
+    PgnMerger merger;
+    auto single = merger.merge({ inputFile }, outputFile, nullptr, nullptr);
+    REQUIRE(single.gamesRead > 0);
+    REQUIRE(single.gamesWritten + single.duplicates == single.gamesRead);
+
+    auto twice = merger.merge({ inputFile, inputFile }, outputFile, nullptr, nullptr);
+    REQUIRE(twice.gamesRead == 2 * single.gamesRead);
+    REQUIRE(twice.gamesWritten == single.gamesWritten);
+    REQUIRE_FALSE(twice.cancelled);
+
+    auto cancelled = merger.merge({ inputFile }, outputFile, nullptr, []() { return true; });
+    REQUIRE(cancelled.cancelled);
+    REQUIRE(cancelled.gamesWritten == 0);
+
+    REQUIRE_THROWS(merger.merge({ outputFile }, outputFile, nullptr, nullptr));
+    std::filesystem::remove(outputFile);
+}
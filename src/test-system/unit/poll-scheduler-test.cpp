@@ -0,0 +1,124 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "callback-manager.h"
+
+#include <chrono>
+
+using QaplaWindows::Visibility;
+using QaplaWindows::Callback::PollScheduler;
+
+namespace {
+    const auto START = PollScheduler::Clock::now();
+
+    PollScheduler::Clock::time_point at(int milliseconds) {
+        return START + std::chrono::milliseconds(milliseconds);
+    }
+}
+
+TEST_CASE("PollScheduler runs callbacks by priority", "[poll-scheduler]") {
+    PollScheduler scheduler;
+    int frameCalls = 0;
+    int backgroundCalls = 0;
+    int idleCalls = 0;
+    auto frameHandle = scheduler.registerCallback([&]() { frameCalls++; });
+    auto backgroundHandle = scheduler.registerCallback(
+        { .name = "background", .priority = PollScheduler::Priority::Background }, [&]() { backgroundCalls++; });
+    auto idleHandle = scheduler.registerCallback(
+        { .name = "idle", .priority = PollScheduler::Priority::Idle }, [&]() { idleCalls++; });
+
+    scheduler.invokeAll(at(0));
+    scheduler.invokeAll(at(50));
+    scheduler.invokeAll(at(100));
+    scheduler.invokeAll(at(150));
+    scheduler.invokeAll(at(1000));
+
+    CHECK(frameCalls == 5);
+    CHECK(backgroundCalls == 3);
+    CHECK(idleCalls == 2);
+
+    backgroundHandle.reset();
+    scheduler.invokeAll(at(2000));
+    CHECK(backgroundCalls == 3);
+    CHECK(scheduler.size() == 2);
+}
+
+TEST_CASE("PollScheduler polls visible callbacks every frame", "[poll-scheduler]") {
+    PollScheduler scheduler;
+    Visibility visibility(scheduler);
+    int calls = 0;
+    auto handle = scheduler.registerCallback(
+        { .name = "window", .priority = PollScheduler::Priority::Background, 
+          .isVisible = [&]() { return visibility.isVisible(); } },
+        [&]() { calls++; });
+
+    // The window is drawn after the poll of each frame
+    scheduler.invokeAll(at(0));
+    visibility.markDrawn();
+    scheduler.invokeAll(at(10));
+    visibility.markDrawn();
+    scheduler.invokeAll(at(20));
+    CHECK(calls == 3);
+
+    // Hidden, back to the background rate
+    scheduler.invokeAll(at(30));
+    scheduler.invokeAll(at(40));
+    scheduler.invokeAll(at(50));
+    CHECK(calls == 3);
+    scheduler.invokeAll(at(120));
+    CHECK(calls == 4);
+    CHECK_FALSE(visibility.isVisible());
+}
+
+TEST_CASE("PollScheduler defers background callbacks over budget", "[poll-scheduler]") {
+    PollScheduler scheduler;
+    scheduler.setFrameBudget(std::chrono::microseconds(0));
+    int frameCalls = 0;
+    int backgroundCalls = 0;
+    auto frameHandle = scheduler.registerCallback({ .name = "frame" }, [&]() { frameCalls++; });
+    auto backgroundHandle = scheduler.registerCallback(
+        { .name = "background", .priority = PollScheduler::Priority::Background }, [&]() { backgroundCalls++; });
+
+    // The first run is overdue and runs regardless of the budget
+    scheduler.invokeAll(at(0));
+    CHECK(backgroundCalls == 1);
+
+    scheduler.invokeAll(at(100));
+    scheduler.invokeAll(at(200));
+    CHECK(backgroundCalls == 1);
+
+    // Deferred for too long
+    scheduler.invokeAll(at(500));
+    CHECK(backgroundCalls == 2);
+    CHECK(frameCalls == 4);
+
+    auto statistics = scheduler.statistics();
+    REQUIRE(statistics.size() == 2);
+    for (const auto& entry : statistics) {
+        if (entry.name == "background") {
+            CHECK(entry.calls == 2);
+            CHECK(entry.deferred == 2);
+        } else {
+            CHECK(entry.calls == 4);
+            CHECK(entry.deferred == 0);
+        }
+    }
+}
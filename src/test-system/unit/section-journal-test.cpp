@@ -0,0 +1,147 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "section-journal.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using QaplaHelpers::IniFile;
+using QaplaWindows::SectionJournal;
+
+namespace {
+    const std::string IDENTITY = "engine A|engine B|0|5";
+
+    IniFile::Section roundSection(const std::string& games) {
+        return IniFile::Section{
+            .name = "round",
+            .entries = IniFile::KeyValueMap{
+                {"id", "sprt-tournament"},
+                {"games", games}
+            }
+        };
+    }
+}
+
+TEST_CASE("SectionJournal returns the newest record", "[section-journal]") {
+    auto path = std::filesystem::temp_directory_path() / "qapla-section-journal-test.journal";
+    std::filesystem::remove(path);
+    SectionJournal journal(path.string());
+
+    CHECK_FALSE(journal.latest(IDENTITY).has_value());
+
+    journal.append(roundSection("1"), IDENTITY);
+    journal.append(roundSection("1="), IDENTITY);
+    journal.append(roundSection("1=0"), IDENTITY);
+
+    auto latest = journal.latest(IDENTITY);
+    REQUIRE(latest.has_value());
+    CHECK(latest->name == "round");
+    CHECK(latest->getValue("games") == "1=0");
+    CHECK_FALSE(latest->getValue("journal").has_value());
+    CHECK_FALSE(latest->getValue("journalid").has_value());
+
+    SECTION("records of another identity are ignored") {
+        CHECK_FALSE(journal.latest("engine A|engine C|0|5").has_value());
+    }
+
+    SECTION("a new session continues the journal") {
+        SectionJournal reopened(path.string());
+        REQUIRE(reopened.latest(IDENTITY).has_value());
+        CHECK(reopened.latest(IDENTITY)->getValue("games") == "1=0");
+        reopened.append(roundSection("1=01"), IDENTITY);
+        CHECK(reopened.latest(IDENTITY)->getValue("games") == "1=01");
+    }
+
+    SECTION("a new identity replaces the journal") {
+        journal.append(roundSection("0"), "engine A|engine C|0|5");
+        CHECK_FALSE(journal.latest(IDENTITY).has_value());
+        CHECK(journal.latest("engine A|engine C|0|5")->getValue("games") == "0");
+    }
+
+    SECTION("a torn record is ignored") {
+        {
+            std::ofstream out(path, std::ios::app);
+            out << "[round]\ngames=+1\n";
+        }
+        REQUIRE(journal.latest(IDENTITY).has_value());
+        CHECK(journal.latest(IDENTITY)->getValue("games") == "1=0");
+    }
+
+    SECTION("reset removes all records") {
+        journal.reset();
+        CHECK_FALSE(journal.latest(IDENTITY).has_value());
+        journal.append(roundSection("1"), IDENTITY);
+        CHECK(journal.latest(IDENTITY)->getValue("games") == "1");
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("SectionJournal appends only the changes of a game", "[section-journal]") {
+    auto path = std::filesystem::temp_directory_path() / "qapla-section-journal-changes.journal";
+    std::filesystem::remove(path);
+    SectionJournal journal(path.string());
+
+    auto section = roundSection("1");
+    section.entries.emplace_back("wincauses", "checkmate:1");
+    journal.append(section, IDENTITY);
+
+    section.entries[1].second = "1=";
+    section.entries.emplace_back("drawcauses", "stalemate:1");
+    journal.append(section, IDENTITY);
+    CHECK(journal.latest(IDENTITY)->entries == section.entries);
+
+    section.entries[1].second = "1==";
+    section.entries.erase(section.entries.begin() + 2);
+    section.entries.emplace_back("drawcauses", "50-move rule:1");
+    journal.append(section, IDENTITY);
+    CHECK(journal.latest(IDENTITY)->entries == section.entries);
+
+    std::ifstream in(path);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    // The game list is extended by the new result, unchanged entries are not repeated
+    CHECK(text.find("games=+=\n") != std::string::npos);
+    CHECK(text.find("id=sprt-tournament") == text.rfind("id=sprt-tournament"));
+    CHECK(text.find("wincauses=-\n") != std::string::npos);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("SectionJournal compacts to the newest record", "[section-journal]") {
+    auto path = std::filesystem::temp_directory_path() / "qapla-section-journal-compact.journal";
+    std::filesystem::remove(path);
+    SectionJournal journal(path.string());
+
+    std::string games;
+    for (size_t game = 1; game <= SectionJournal::MAX_RECORDS + 1; ++game) {
+        games += '1';
+        journal.append(roundSection(games), IDENTITY);
+    }
+    auto size = std::filesystem::file_size(path);
+    CHECK(size < games.size() + 200);
+    REQUIRE(journal.latest(IDENTITY).has_value());
+    CHECK(journal.latest(IDENTITY)->getValue("games") == games);
+
+    std::filesystem::remove(path);
+}
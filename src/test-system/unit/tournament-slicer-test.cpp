@@ -0,0 +1,116 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tournament-slicer.h"
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+using QaplaHelpers::IniFile;
+using QaplaWindows::TournamentSlice;
+using QaplaWindows::TournamentSlicer;
+
+namespace {
+    IniFile::Section round(const std::string& engineA, const std::string& engineB, const std::string& games) {
+        return IniFile::Section{
+            .name = "round",
+            .entries = IniFile::KeyValueMap{
+                {"round", "2"},
+                {"engineA", engineA},
+                {"engineB", engineB},
+                {"games", games},
+                {"wincauses", "checkmate:2"},
+                {"drawcauses", "50-move rule:1"},
+                {"losscauses", "adjudication:1"}
+            }
+        };
+    }
+
+    std::set<std::pair<size_t, size_t>> pairings(const std::vector<TournamentSlice>& slices) {
+        std::set<std::pair<size_t, size_t>> result;
+        for (const auto& slice : slices) {
+            for (auto opponent : slice.opponents) {
+                auto inserted = result.insert(std::minmax(slice.gauntlet, opponent)).second;
+                REQUIRE(inserted);
+            }
+        }
+        return result;
+    }
+}
+
+TEST_CASE("TournamentSlicer covers every round robin pairing once", "[tournament-slicer]") {
+    auto slices = TournamentSlicer::plan(6, {}, false, 8);
+    CHECK(slices.size() >= 8);
+    CHECK(pairings(slices).size() == 15);
+}
+
+TEST_CASE("TournamentSlicer splits a single gauntlet engine", "[tournament-slicer]") {
+    std::vector<bool> gauntlets{ false, true, false, false, false, false };
+    auto slices = TournamentSlicer::plan(gauntlets.size(), gauntlets, true, 4);
+    REQUIRE(slices.size() == 4);
+    for (const auto& slice : slices) {
+        CHECK(slice.gauntlet == 1);
+    }
+    CHECK(pairings(slices).size() == 5);
+}
+
+TEST_CASE("TournamentSlicer balances slices over workers", "[tournament-slicer]") {
+    auto slices = TournamentSlicer::plan(9, {}, false, 0);
+    auto assignment = TournamentSlicer::assign(slices, 3);
+    REQUIRE(assignment.size() == 3);
+
+    size_t maxLoad = 0;
+    size_t assigned = 0;
+    for (const auto& indices : assignment) {
+        size_t games = 0;
+        for (auto index : indices) {
+            games += slices[index].opponents.size();
+        }
+        maxLoad = std::max(maxLoad, games);
+        assigned += indices.size();
+    }
+    CHECK(assigned == slices.size());
+    // 36 pairings, at most one above the even share
+    CHECK(maxLoad <= 13);
+}
+
+TEST_CASE("TournamentSlicer orients round sections to the loading tournament", "[tournament-slicer]") {
+    IniFile::SectionList rounds{ round("B", "A", "110=0"), round("A", "C", "1=") };
+    auto oriented = TournamentSlicer::orientRounds(rounds, { {"A", "B"}, {"A", "C"} });
+    REQUIRE(oriented.size() == 2);
+
+    const auto& swapped = oriented[0];
+    CHECK(swapped.getValue("engineA") == "A");
+    CHECK(swapped.getValue("engineB") == "B");
+    CHECK(swapped.getValue("games") == "001=1");
+    CHECK(swapped.getValue("wincauses") == "adjudication:1");
+    CHECK(swapped.getValue("drawcauses") == "50-move rule:1");
+    CHECK(swapped.getValue("losscauses") == "checkmate:2");
+
+    CHECK(oriented[1].getValue("engineA") == "A");
+    CHECK(oriented[1].getValue("games") == "1=");
+    CHECK(oriented[1].getValue("wincauses") == "checkmate:2");
+
+    CHECK(TournamentSlicer::roundKey(rounds[0]) == TournamentSlicer::roundKey(swapped));
+    CHECK(TournamentSlicer::roundKey(rounds[0]) != TournamentSlicer::roundKey(rounds[1]));
+}
@@ -0,0 +1,143 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "worker-protocol.h"
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using QaplaWindows::PgnGameSplitter;
+using QaplaWindows::WorkerFrameCodec;
+using QaplaWindows::WorkerListener;
+using QaplaWindows::WorkerMessage;
+using QaplaWindows::WorkerMessageType;
+using QaplaWindows::WorkerSocket;
+
+TEST_CASE("WorkerFrameCodec decodes frames split at any byte", "[worker-protocol]") {
+    std::string stream = WorkerFrameCodec::encode({ .type = WorkerMessageType::Hello, .payload = "3" })
+        + WorkerFrameCodec::encode({ .type = WorkerMessageType::Games, .payload = std::string(1000, 'x') })
+        + WorkerFrameCodec::encode({ .type = WorkerMessageType::Done, .payload = "" });
+
+    WorkerFrameCodec codec;
+    std::vector<WorkerMessage> messages;
+    for (char byte : stream) {
+        codec.feed(std::string_view(&byte, 1));
+        while (auto message = codec.next()) {
+            messages.push_back(std::move(*message));
+        }
+    }
+
+    REQUIRE(messages.size() == 3);
+    CHECK(messages[0].type == WorkerMessageType::Hello);
+    CHECK(messages[0].payload == "3");
+    CHECK(messages[1].type == WorkerMessageType::Games);
+    CHECK(messages[1].payload.size() == 1000);
+    CHECK(messages[2].type == WorkerMessageType::Done);
+    CHECK(messages[2].payload.empty());
+}
+
+TEST_CASE("WorkerFrameCodec rejects oversized frames", "[worker-protocol]") {
+    WorkerFrameCodec codec;
+    const std::string header{ '\xff', '\xff', '\xff', '\xff', '\x03' };
+    codec.feed(header);
+    CHECK_THROWS(codec.next());
+}
+
+TEST_CASE("PgnGameSplitter cuts games at the next tag section only", "[worker-protocol]") {
+    const std::string first = "[Event \"A\"]\n[White \"x]\\\"y\"]\n\n"
+        "1. e4 {engine said:\n[Event \"inside\"]} e5 1-0\n\n";
+    const std::string second = "[Event \"B\"]\n\n1. d4 ; [Event\n d5 0-1\n\n";
+    const std::string third = "[Event \"C\"]\n\n1. c4";
+
+    PgnGameSplitter splitter;
+    std::string text = first + second + third;
+    std::vector<std::string> games;
+    // Fed in pieces, so tags and comments are split between reads
+    for (size_t pos = 0; pos < text.size(); pos += 7) {
+        splitter.feed(std::string_view(text).substr(pos, 7));
+        auto taken = splitter.take(false);
+        games.insert(games.end(), taken.begin(), taken.end());
+    }
+    REQUIRE(games.size() == 2);
+    CHECK(games[0] == first);
+    CHECK(games[1] == second);
+
+    splitter.feed(" c5 1/2-1/2\n\n");
+    auto last = splitter.take(false);
+    REQUIRE(last.size() == 1);
+    CHECK(last[0] == third + " c5 1/2-1/2\n\n");
+    CHECK(splitter.take(true).empty());
+}
+
+TEST_CASE("PgnGameSplitter keeps an unfinished game until all text is requested", "[worker-protocol]") {
+    PgnGameSplitter splitter;
+    splitter.feed("[Event \"A\"]\n\n1. e4 e5");
+    CHECK(splitter.take(false).empty());
+    auto games = splitter.take(true);
+    REQUIRE(games.size() == 1);
+    CHECK(games[0] == "[Event \"A\"]\n\n1. e4 e5");
+}
+
+#ifndef _WIN32
+
+TEST_CASE("WorkerSocket exchanges messages over a Unix domain socket", "[worker-protocol]") {
+    auto path = std::filesystem::temp_directory_path() / std::format("qapla-test-{}.sock", ::getpid());
+    WorkerListener listener;
+    listener.listen("unix:" + path.string());
+
+    WorkerSocket client = WorkerSocket::connect(listener.address());
+    std::optional<WorkerSocket> server;
+    for (int tries = 0; tries < 100 && !server; ++tries) {
+        server = listener.accept();
+        if (!server) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    REQUIRE(server.has_value());
+
+    const std::string job(200000, 'j');
+    REQUIRE(server->send({ .type = WorkerMessageType::Job, .payload = job }));
+    auto received = client.receive(5000);
+    REQUIRE(received.has_value());
+    CHECK(received->type == WorkerMessageType::Job);
+    CHECK(received->payload == job);
+
+    REQUIRE(client.send({ .type = WorkerMessageType::Progress, .payload = "4 2" }));
+    auto progress = server->receive(5000);
+    REQUIRE(progress.has_value());
+    CHECK(progress->payload == "4 2");
+
+    client.close();
+    CHECK_FALSE(server->receive(1000).has_value());
+    CHECK_FALSE(server->isOpen());
+
+    listener.close();
+    CHECK_FALSE(std::filesystem::exists(path));
+}
+
+#endif
@@ -22,10 +22,15 @@
 #include "tournament-data.h"
 #include "tournament-result-incremental.h"
 #include "tournament-result-view.h"
+#include "tournament-config-sections.h"
+#include "distributed-tournament.h"
+#include "tournament-slicer.h"
 #include "viewer-board-window.h"
 #include "viewer-board-window-list.h"
 #include "snackbar.h"
 #include "imgui-concurrency.h"
+#include "resource-budget.h"
+#include "cpu-affinity.h"
 #include "imgui-engine-global-settings.h"
 #include "configuration.h"
 
@@ -44,6 +49,7 @@
 #include <game-manager/adjudication-manager.h>
 #include "imgui-table.h"
 
+#include <algorithm>
 #include <format>
 
 
@@ -73,7 +79,8 @@ namespace QaplaWindows {
                 { .name = "Black", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 150.0F },
                 { .name = "Round", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 50.0F },
                 { .name = "Game", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 50.0F },
-                { .name = "Opening", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 50.0F }
+                { .name = "Opening", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 50.0F },
+                { .name = "CPUs", .flags = ImGuiTableColumnFlags_WidthFixed, .width = 100.0F }
             }
 		),
         adjudicationTable_(
@@ -157,6 +164,11 @@ namespace QaplaWindows {
 
         // Poll callback to regularly update tournament data
         pollCallbackHandle_ = StaticCallbacks::poll().registerCallback(
+            Callback::PollScheduler::Options{
+                .name = "Tournament",
+                .priority = Callback::PollScheduler::Priority::Background,
+                .isVisible = [this]() { return visibility_.isVisible() || boardWindowList_.isVisible(); }
+            },
 		    [this]() {
     			this->pollData();
 		    }
@@ -295,6 +307,11 @@ namespace QaplaWindows {
         if (!createTournament(true)) {
             return;
         }
+        distributed_.reset();
+        if (workerModeEnabled_ && workerProcesses_ > 1 && DistributedTournament::isSupported()) {
+            startDistributed(verbose);
+            return;
+        }
 
         state_ = State::Starting;
 
@@ -305,6 +322,8 @@ namespace QaplaWindows {
         runningTable_.clear();
         populateRunningTable();
         imguiConcurrency_->init();
+        imguiConcurrency_->setResourceLimit(
+            ResourceBudget::instance().maxConcurrentPairings(getSelectedEngines()));
         imguiConcurrency_->setActive(true);
 
         if (verbose) {
@@ -313,6 +332,81 @@ namespace QaplaWindows {
         }
 	}
 
+    void TournamentData::startDistributed(bool verbose) {
+        using namespace QaplaConfiguration;
+        DistributedTournament::Job job;
+        job.configSections.push_back(toTournamentSection(*config_, "tournament"));
+        job.configSections.push_back(toOpeningsSection(config_->openings, "tournament"));
+        job.configSections.push_back(toPgnOutputSection(pgnConfig(), "tournament"));
+        if (drawConfig().active) {
+            job.configSections.push_back(toDrawAdjudicationSection(drawConfig(), "tournament"));
+        }
+        if (resignConfig().active) {
+            job.configSections.push_back(toResignAdjudicationSection(resignConfig(), "tournament"));
+        }
+        job.engines = getSelectedEngines();
+        job.gauntletMode = config_->type == "gauntlet";
+        job.workers = workerProcesses_;
+        job.concurrency = std::min(getExternalConcurrency(), 
+            ResourceBudget::instance().maxConcurrentPairings(job.engines));
+        job.pgnFile = pgnConfig().file;
+        job.rounds = tournament_->getSections();
+
+        try {
+            distributed_ = std::make_unique<DistributedTournament>();
+            distributed_->start(job);
+        }
+        catch (const std::exception& e) {
+            distributed_.reset();
+            SnackbarManager::instance().showError(std::string("Failed to start worker processes: ") + e.what(),
+                false, "tournament");
+            return;
+        }
+
+        state_ = State::Starting;
+        eloTable_.clear();
+        populateEloTable();
+        runningTable_.clear();
+        if (verbose) {
+            SnackbarManager::instance().showSuccess(
+                std::format("Tournament started in {} worker processes", workerProcesses_), 
+                false, "tournament");
+        }
+    }
+
+    void TournamentData::pollDistributed() {
+        if (distributed_->isActive()) {
+            distributed_->poll();
+        }
+        if (auto error = distributed_->takeError()) {
+            SnackbarManager::instance().showError(*error, false, "tournament");
+        }
+
+        if (auto rounds = distributed_->takeRounds()) {
+            // Rebuilt like a loaded tournament, so results, saving and resuming work as without workers
+            tournament_ = std::make_unique<Tournament>();
+            result_ = std::make_unique<TournamentResultIncremental>();
+            tournament_->createTournament(getSelectedEngines(), *config_);
+            tournament_->load(TournamentSlicer::orientRounds(std::move(*rounds), 
+                TournamentSlicer::pairings(*tournament_)));
+        }
+        if (result_->poll(*tournament_, config_->averageElo)) {
+            updateTournamentResults();
+            populateEloTable();
+            populateCauseTable();
+            populateMatrixTable();
+        }
+
+        if (state_ == State::Starting && distributed_->runningGames() > 0) {
+            state_ = State::Running;
+        }
+        if (state_ != State::Stopped && !distributed_->isActive()) {
+            state_ = State::Stopped;
+            SnackbarManager::instance().showSuccess("Tournament finished.", 
+                false, "tournament");
+        }
+    }
+
     TournamentConfig& TournamentData::config() {
         return *config_;
     }
@@ -480,13 +574,14 @@ namespace QaplaWindows {
         runningTable_.clear();
         if (tournament_) {
             poolAccess_->withGameRecords(
-                [&](const GameRecord& game, [[maybe_unused]] uint32_t gameIndex) {
+                [&](const GameRecord& game, uint32_t gameIndex) {
                     std::vector<std::string> row;
                     row.push_back(game.getWhiteEngineName());
                     row.push_back(game.getBlackEngineName());
                     row.push_back(std::to_string(game.getRound()));
                     row.push_back(std::to_string(game.getGameInRound()));
                     row.push_back(std::to_string(game.getOpeningNo()));
+                    row.push_back(CpuAffinityManager::instance().getSlotCpus(gameIndex));
                     runningTable_.push(row);
                     runningCount_++;
                 },
@@ -506,6 +601,11 @@ namespace QaplaWindows {
 	}
 
     void TournamentData::pollData() {
+        if (distributed_) {
+            pollDistributed();
+            return;
+        }
+        imguiConcurrency_->poll();
         if (tournament_) {
             if (result_->poll(*tournament_, config_->averageElo)) {
                 updateTournamentResults();
@@ -617,6 +717,9 @@ namespace QaplaWindows {
             // If we are not graceful, we stop all immediately
             poolAccess_->stopAll();
         }
+        if (distributed_) {
+            distributed_->stop(graceful);
+        }
         if (oldState == State::Stopping) {
             SnackbarManager::instance().showNote("Tournament is already stopping.", 
                 false, "tournament");
@@ -643,7 +746,7 @@ namespace QaplaWindows {
     }
 
     void TournamentData::clear(bool verbose) {
-        if (!hasTasksScheduled()) {
+        if (!hasTasksScheduled() && !distributed_) {
             if (verbose) {
                 SnackbarManager::instance().showNote("Nothing to clear.", 
                     false, "tournament");
@@ -652,6 +755,7 @@ namespace QaplaWindows {
         }
         imguiConcurrency_->setActive(false);
         poolAccess_->clearAll();
+        distributed_.reset();
         tournament_ = std::make_unique<Tournament>();
         result_ = std::make_unique<TournamentResultIncremental>();
         if (state_ == State::Running) {
@@ -672,10 +776,26 @@ namespace QaplaWindows {
         return imguiConcurrency_->getExternalConcurrency();
     }
 
+    uint32_t TournamentData::getResourceLimit() const {
+        return imguiConcurrency_->getResourceLimit();
+    }
+
     void TournamentData::setExternalConcurrency(uint32_t count) {
         imguiConcurrency_->setExternalConcurrency(count);
     }
 
+    void TournamentData::setAutoConcurrency(bool autoMode) {
+        imguiConcurrency_->setAutoMode(autoMode);
+    }
+
+    bool TournamentData::isAutoConcurrency() const {
+        return imguiConcurrency_->isAutoMode();
+    }
+
+    uint32_t TournamentData::getCurrentConcurrency() const {
+        return imguiConcurrency_->getCurrentConcurrency();
+    }
+
     void TournamentData::setPoolConcurrency(uint32_t count, bool nice, bool direct) {
         if (!isRunning()) {
             return;
@@ -684,6 +804,41 @@ namespace QaplaWindows {
         imguiConcurrency_->setNiceStop(nice);
     }
 
+    void TournamentData::setWorkerProcesses(uint32_t count) {
+        workerProcesses_ = std::clamp(count, 1U, MAX_WORKER_PROCESSES);
+        updateWorkerConfig();
+    }
+
+    void TournamentData::setWorkerModeEnabled(bool enabled) {
+        workerModeEnabled_ = enabled;
+        updateWorkerConfig();
+    }
+
+    void TournamentData::updateWorkerConfig() const {
+        QaplaHelpers::IniFile::Section section{
+            .name = "workers",
+            .entries = QaplaHelpers::IniFile::KeyValueMap{
+                {"id", "tournament"},
+                {"experimental", workerModeEnabled_ ? "true" : "false"},
+                {"processes", std::to_string(workerProcesses_)}
+            }
+        };
+        QaplaConfiguration::Configuration::instance().getConfigData().setSectionList(
+            "workers", "tournament", { section });
+    }
+
+    void TournamentData::loadWorkerConfig() {
+        auto sections = QaplaConfiguration::Configuration::instance()
+            .getConfigData().getSectionList("workers", "tournament")
+            .value_or(std::vector<QaplaHelpers::IniFile::Section>{});
+        if (sections.empty()) {
+            return;
+        }
+        workerModeEnabled_ = sections[0].getValue("experimental").value_or("false") == "true";
+        auto processes = QaplaHelpers::to_uint32(sections[0].getValue("processes").value_or("1"));
+        workerProcesses_ = std::clamp(processes.value_or(1U), 1U, MAX_WORKER_PROCESSES);
+    }
+
     void TournamentData::loadTournamentConfig() {
         tournamentConfiguration_->loadConfiguration();
     }
@@ -743,6 +898,7 @@ namespace QaplaWindows {
         loadConfigStep("adjudication", [this] { tournamentAdjudication_->loadConfiguration(); });
         loadConfigStep("engine selection", [this] { loadEngineSelectionConfig(); });
         loadConfigStep("global engine settings", [this] { loadGlobalSettingsConfig(); });
+        loadConfigStep("worker", [this] { loadWorkerConfig(); });
     }
 
     void TournamentData::saveTournament(const std::string& filename) {
@@ -57,6 +57,7 @@ class ImGuiConcurrency;
 namespace QaplaWindows {
 
     class TournamentResultIncremental;
+    class DistributedTournament;
 
 	class TournamentData {
     public: 
@@ -82,6 +83,14 @@ namespace QaplaWindows {
 		 */
         void pollData();
 
+        /**
+         * @brief Marks the window showing the data as drawn in the current frame.
+         * Visible data is polled every frame, hidden data at background rate.
+         */
+        void markDrawn() {
+            visibility_.markDrawn();
+        }
+
         /**
 		 * @brief Clears the current analysis results.
          * @param verbose If true, enables snackbar infos.
@@ -100,12 +109,37 @@ namespace QaplaWindows {
          */
         uint32_t getExternalConcurrency() const;
 
+        /**
+         * @brief Gets the number of concurrent games fitting into the resource budget.
+         * @return The game limit of the running calculation.
+         */
+        uint32_t getResourceLimit() const;
+
         /**
          * @brief Sets the external concurrency value.
          * @param count The new external concurrency value.
          */
         void setExternalConcurrency(uint32_t count);
 
+        /**
+         * @brief Enables or disables the adaptive concurrency mode. The concurrency
+         * value then is the upper limit of the automatically chosen concurrency.
+         * @param autoMode True to enable auto mode.
+         */
+        void setAutoConcurrency(bool autoMode);
+
+        /**
+         * @brief Checks if the adaptive concurrency mode is enabled.
+         * @return True if auto mode is enabled.
+         */
+        bool isAutoConcurrency() const;
+
+        /**
+         * @brief Gets the concurrency currently applied to the pool.
+         * @return The applied concurrency.
+         */
+        uint32_t getCurrentConcurrency() const;
+
         /**
          * @brief Sets the pool concurrency level.
          * @param count The number of concurrent tasks to allow.
@@ -114,6 +148,39 @@ namespace QaplaWindows {
          */
         void setPoolConcurrency(uint32_t count, bool nice = true, bool direct = false);
 
+        static constexpr uint32_t MAX_WORKER_PROCESSES = 64;
+
+        /**
+         * @brief Checks if the experimental worker process mode is enabled. 
+         * 
+         * Results of games played by workers are loaded into the tournament and saved with it. 
+         * The running games and the adjudication tests of the workers are not shown.
+         */
+        bool isWorkerModeEnabled() const {
+            return workerModeEnabled_;
+        }
+
+        /**
+         * @brief Enables or disables the experimental worker process mode and stores it in 
+         * the configuration.
+         */
+        void setWorkerModeEnabled(bool enabled);
+
+        /**
+         * @brief Gets the number of worker processes playing the tournament. With more than 
+         * one worker the games are played in child processes, see DistributedTournament.
+         * @return The number of worker processes, 1 plays in the GUI process.
+         */
+        uint32_t getWorkerProcesses() const {
+            return workerProcesses_;
+        }
+
+        /**
+         * @brief Sets the number of worker processes and stores it in the configuration.
+         * @param count The number of worker processes.
+         */
+        void setWorkerProcesses(uint32_t count);
+
         /**
          * @brief Draws the tournament elo table.
          * @param size Size of the table to draw.
@@ -428,6 +495,23 @@ namespace QaplaWindows {
          */
         void loadGlobalSettingsConfig();
 
+        /**
+         * @brief Loads the number of worker processes from configuration data.
+         */
+        void loadWorkerConfig();
+        void updateWorkerConfig() const;
+
+        /**
+         * @brief Starts the created tournament in worker processes.
+         * @param verbose If true, enables snackbar info on success.
+         */
+        void startDistributed(bool verbose);
+
+        /**
+         * @brief Polls the worker processes and loads their results into the tournament.
+         */
+        void pollDistributed();
+
         /**
          * @brief Sets up callbacks for engine selection and global settings.
          */
@@ -471,10 +555,14 @@ namespace QaplaWindows {
         std::unique_ptr<ImGuiTournamentConfiguration> tournamentConfiguration_{std::make_unique<ImGuiTournamentConfiguration>()};
 
         GameManagerPoolAccess poolAccess_;
+        std::unique_ptr<DistributedTournament> distributed_;  ///< Set while playing in worker processes
+        uint32_t workerProcesses_ = 1;
+        bool workerModeEnabled_ = false;  ///< Experimental, see isWorkerModeEnabled
         QaplaTester::EngineGlobalConfig eachEngineConfig_;
         std::vector<ImGuiEngineSelect::EngineConfiguration> engineConfigurations_; 
         std::unique_ptr<Callback::UnregisterHandle> pollCallbackHandle_;
         std::unique_ptr<Callback::UnregisterHandle> messageCallbackHandle_;
+        Visibility visibility_;
 
 		uint32_t runningCount_ = 0; ///< Number of currently running games
 
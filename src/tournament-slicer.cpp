@@ -0,0 +1,142 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "tournament-slicer.h"
+
+#include <tournament/tournament.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <set>
+
+namespace QaplaWindows {
+
+std::vector<TournamentSlice> TournamentSlicer::plan(size_t engineCount, 
+    const std::vector<bool>& gauntlets, bool gauntletMode, size_t minSlices) {
+    
+    std::vector<TournamentSlice> slices;
+    auto isGauntlet = [&](size_t index) { return index < gauntlets.size() && gauntlets[index]; };
+    for (size_t engine = 0; engine < engineCount; ++engine) {
+        TournamentSlice slice{ .gauntlet = engine, .opponents = {} };
+        if (gauntletMode) {
+            if (!isGauntlet(engine)) {
+                continue;
+            }
+            for (size_t opponent = 0; opponent < engineCount; ++opponent) {
+                if (!isGauntlet(opponent)) {
+                    slice.opponents.push_back(opponent);
+                }
+            }
+        } else {
+            for (size_t opponent = engine + 1; opponent < engineCount; ++opponent) {
+                slice.opponents.push_back(opponent);
+            }
+        }
+        if (!slice.opponents.empty()) {
+            slices.push_back(std::move(slice));
+        }
+    }
+
+    // Few large slices, e.g. a gauntlet with a single gauntlet engine, are halved
+    while (slices.size() < minSlices) {
+        auto largest = std::ranges::max_element(slices, {}, 
+            [](const TournamentSlice& slice) { return slice.opponents.size(); });
+        if (largest == slices.end() || largest->opponents.size() < 2) {
+            break;
+        }
+        auto half = static_cast<std::ptrdiff_t>(largest->opponents.size() / 2);
+        TournamentSlice second{ .gauntlet = largest->gauntlet, 
+            .opponents = { largest->opponents.begin() + half, largest->opponents.end() } };
+        largest->opponents.resize(static_cast<size_t>(half));
+        slices.push_back(std::move(second));
+    }
+    return slices;
+}
+
+std::vector<std::vector<size_t>> TournamentSlicer::assign(
+    const std::vector<TournamentSlice>& slices, uint32_t workers) {
+    
+    std::vector<std::vector<size_t>> result(std::max(1U, workers));
+    std::vector<size_t> load(result.size(), 0);
+    std::vector<size_t> order(slices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, std::greater<>{}, 
+        [&](size_t index) { return slices[index].opponents.size(); });
+    for (auto index : order) {
+        auto worker = static_cast<size_t>(std::ranges::min_element(load) - load.begin());
+        result[worker].push_back(index);
+        load[worker] += slices[index].opponents.size();
+    }
+    return result;
+}
+
+std::vector<TournamentSlicer::Pairing> TournamentSlicer::pairings(const QaplaTester::Tournament& tournament) {
+    std::vector<Pairing> result;
+    for (size_t index = 0; auto pairTournament = tournament.getPairTournament(index); ++index) {
+        auto duel = (*pairTournament)->getResult();
+        result.emplace_back(duel.getEngineA(), duel.getEngineB());
+    }
+    return result;
+}
+
+QaplaHelpers::IniFile::SectionList TournamentSlicer::orientRounds(
+    QaplaHelpers::IniFile::SectionList rounds, const std::vector<Pairing>& pairings) {
+    
+    const std::set<Pairing> oriented(pairings.begin(), pairings.end());
+    for (auto& round : rounds) {
+        Pairing engines{ round.getValue("engineA").value_or(""), round.getValue("engineB").value_or("") };
+        if (oriented.contains(engines) || !oriented.contains({ engines.second, engines.first })) {
+            continue;
+        }
+        for (auto& [key, value] : round.entries) {
+            if (key == "engineA") {
+                value = engines.second;
+            } else if (key == "engineB") {
+                value = engines.first;
+            } else if (key == "wincauses") {
+                key = "losscauses";
+            } else if (key == "losscauses") {
+                key = "wincauses";
+            } else if (key == "games") {
+                // Results are given from the view of engine A
+                for (auto& result : value) {
+                    if (result == '1') {
+                        result = '0';
+                    } else if (result == '0') {
+                        result = '1';
+                    }
+                }
+            }
+        }
+    }
+    return rounds;
+}
+
+std::string TournamentSlicer::roundKey(const QaplaHelpers::IniFile::Section& round) {
+    auto engineA = round.getValue("engineA").value_or("");
+    auto engineB = round.getValue("engineB").value_or("");
+    if (engineB < engineA) {
+        std::swap(engineA, engineB);
+    }
+    return round.getValue("round").value_or("") + '\n' + engineA + '\n' + engineB;
+}
+
+} // namespace QaplaWindows
@@ -0,0 +1,101 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <base-elements/ini-file.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace QaplaTester {
+    class Tournament;
+}
+
+namespace QaplaWindows {
+
+/**
+ * @brief Part of a tournament played by one worker: a single gauntlet engine against a set 
+ * of opponents. Engines are given as indices into the engine list of the tournament.
+ */
+struct TournamentSlice {
+    size_t gauntlet = 0;
+    std::vector<size_t> opponents;
+};
+
+/**
+ * @brief Splits the pairings of a tournament into disjoint gauntlet slices for worker processes.
+ * 
+ * A round robin of n engines becomes the slices "engine i against all engines after i", a
+ * gauntlet becomes one slice per gauntlet engine. Together the slices contain every pairing 
+ * exactly once, so the results of the workers add up to the result of the tournament.
+ * 
+ * Results travel between the tournament and its slices as "round" sections, the format 
+ * the tournament is saved and resumed in.
+ */
+class TournamentSlicer {
+public:
+    using Pairing = std::pair<std::string, std::string>;  ///< Names of engine A and engine B
+
+    /**
+     * @brief Plans the slices of a tournament.
+     * @param engineCount Number of engines in the tournament.
+     * @param gauntlets Flags marking the gauntlet engines, used if gauntletMode is true.
+     * @param gauntletMode True for a gauntlet, false for a round robin.
+     * @param minSlices Slices with many opponents are split until there are at least this many.
+     * @return The slices, each with at least one opponent.
+     */
+    [[nodiscard]] static std::vector<TournamentSlice> plan(size_t engineCount, 
+        const std::vector<bool>& gauntlets, bool gauntletMode, size_t minSlices);
+
+    /**
+     * @brief Distributes slices to workers, largest slices first to the least loaded worker.
+     * @param slices Slices to distribute.
+     * @param workers Number of workers.
+     * @return Indices of the slices per worker.
+     */
+    [[nodiscard]] static std::vector<std::vector<size_t>> assign(
+        const std::vector<TournamentSlice>& slices, uint32_t workers);
+
+    /**
+     * @brief Gets the engine names of the pair tournaments of a tournament.
+     */
+    [[nodiscard]] static std::vector<Pairing> pairings(const QaplaTester::Tournament& tournament);
+
+    /**
+     * @brief Orients round sections to the given pairings. A section naming the engines in 
+     * the opposite order gets its engines, its game results and its win and loss causes swapped.
+     * @param rounds Round sections, e.g. from Tournament::getSections().
+     * @param pairings Pairings of the tournament loading the sections.
+     * @return The oriented sections.
+     */
+    [[nodiscard]] static QaplaHelpers::IniFile::SectionList orientRounds(
+        QaplaHelpers::IniFile::SectionList rounds, const std::vector<Pairing>& pairings);
+
+    /**
+     * @brief Gets a key identifying the round and the engines of a round section, 
+     * independent of the order of the engines.
+     */
+    [[nodiscard]] static std::string roundKey(const QaplaHelpers::IniFile::Section& round);
+};
+
+} // namespace QaplaWindows
@@ -19,6 +19,7 @@
 
 #include "tournament-window.h"
 #include "tournament-data.h"
+#include "distributed-tournament.h"
 #include "imgui-table.h"
 #include "imgui-button.h"
 #include "snackbar.h"
@@ -27,6 +28,7 @@
 #include "imgui-controls.h"
 #include "imgui-engine-global-settings.h"
 #include "configuration.h"
+#include "imgui-concurrency.h"
 
 #include <chess-game/move-record.h>
 #include <chess-game/game-record.h>
@@ -226,15 +228,31 @@ bool TournamentWindow::drawInput() {
     
 	constexpr float inputWidth = 200.0F;
     constexpr float fileInputWidth = inputWidth + 100.0F;
-    constexpr int maxConcurrency = 32;
 	auto& tournamentData = TournamentData::instance();
     
     ImGui::SetNextItemWidth(inputWidth);
     auto concurrency = tournamentData.getExternalConcurrency();
-    ImGuiControls::sliderInt<uint32_t>("Concurrency", concurrency, 1, maxConcurrency);
+    ImGuiControls::sliderInt<uint32_t>("Concurrency", concurrency, 1, ImGuiConcurrency::maxConcurrency());
     ImGuiControls::hooverTooltip("Number of games running in parallel");
     tournamentData.setExternalConcurrency(concurrency);
     tournamentData.setPoolConcurrency(concurrency, true);
+    ImGui::SameLine();
+    auto autoConcurrency = tournamentData.isAutoConcurrency();
+    if (ImGuiControls::checkbox("Auto", autoConcurrency)) {
+        tournamentData.setAutoConcurrency(autoConcurrency);
+    }
+    ImGuiControls::hooverTooltip("Adapts the number of parallel games to the CPU load.\n"
+        "Reduces it when games lose on time, the slider value is the upper limit.");
+    if (tournamentData.isAutoConcurrency() && tournamentData.getCurrentConcurrency() > 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(running %u)", tournamentData.getCurrentConcurrency());
+    }
+    if (tournamentData.getResourceLimit() < concurrency) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(limited to %u)", tournamentData.getResourceLimit());
+        ImGuiControls::hooverTooltip("The engines' Threads and Hash settings allow fewer parallel games.\n"
+            "The budget is configured in the Settings tab.");
+    }
     drawProgress();
     
     ImGui::Spacing();
@@ -247,6 +265,19 @@ bool TournamentWindow::drawInput() {
 
     bool changed = false;
 
+    if (tournamentData.isWorkerModeEnabled() && DistributedTournament::isSupported()) {
+        ImGui::Indent(10.0F);
+        ImGui::SetNextItemWidth(inputWidth);
+        auto workers = tournamentData.getWorkerProcesses();
+        if (ImGuiControls::sliderInt<uint32_t>("Worker processes", workers, 1, TournamentData::MAX_WORKER_PROCESSES)) {
+            tournamentData.setWorkerProcesses(workers);
+        }
+        ImGuiControls::hooverTooltip("Experimental: plays the tournament in several background processes.\n"
+            "Results are saved and resumed as usual, the running games and the adjudication\n"
+            "tests of the workers are not shown.");
+        ImGui::Unindent(10.0F);
+    }
+
     globalSettingsTutorial_.highlight = (highlightedSection_ == "GlobalSettings");
     changed |= tournamentData.getGlobalSettings().drawGlobalSettings(
         { .controlWidth = inputWidth, .controlIndent = 10.0F }, {}, globalSettingsTutorial_);
@@ -294,6 +325,7 @@ void TournamentWindow::drawProgress()
 void TournamentWindow::draw() {
     constexpr float rightBorder = 5.0F;
     auto& tournamentData = TournamentData::instance();
+    tournamentData.markDrawn();
     auto clickedButton = drawButtons();
     
     if (!clickedButton.empty()) {
@@ -0,0 +1,357 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "tournament-worker.h"
+#include "worker-protocol.h"
+#include "tournament-slicer.h"
+#include "config-group-loader.h"
+#include "configuration.h"
+#include "game-manager-pool-access.h"
+
+#include <base-elements/change-tracker.h>
+#include <base-elements/ini-file.h>
+#include <base-elements/string-helper.h>
+#include <config/adjudication-config.h>
+#include <config/opening-config.h>
+#include <config/pgn-config.h>
+#include <engine-handling/engine-config.h>
+#include <game-manager/game-manager-pool.h>
+#include <opening/pgn-save.h>
+#include <tournament/tournament.h>
+#include <tournament/tournament-config.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using QaplaHelpers::IniFile;
+using QaplaTester::EngineConfig;
+using QaplaTester::Tournament;
+using QaplaTester::TournamentConfig;
+
+namespace QaplaWindows {
+
+namespace {
+    constexpr int JOB_TIMEOUT_MS = 30000;
+    constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+    constexpr auto PROGRESS_INTERVAL = std::chrono::seconds(1);
+    constexpr auto START_GRACE_TIME = std::chrono::seconds(5);
+
+    IniFile::SectionList sectionsNamed(const IniFile::SectionList& sections, const std::string& name) {
+        IniFile::SectionList result;
+        for (const auto& section : sections) {
+            if (section.name == name) {
+                result.push_back(section);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the round sections of the pairings of a slice, the gauntlet engine comes first.
+     */
+    IniFile::SectionList roundsOfSlice(const IniFile::SectionList& rounds, const std::vector<EngineConfig>& engines) {
+        IniFile::SectionList result;
+        auto isOpponent = [&](const std::string& name) {
+            return std::ranges::any_of(engines.begin() + 1, engines.end(), 
+                [&](const EngineConfig& engine) { return engine.getName() == name; });
+        };
+        const auto& gauntlet = engines.front().getName();
+        for (const auto& round : rounds) {
+            auto engineA = round.getValue("engineA").value_or("");
+            auto engineB = round.getValue("engineB").value_or("");
+            if ((engineA == gauntlet && isOpponent(engineB)) || (engineB == gauntlet && isOpponent(engineA))) {
+                result.push_back(round);
+            }
+        }
+        return result;
+    }
+
+    std::vector<size_t> parseIndices(const std::string& text) {
+        std::vector<size_t> result;
+        std::istringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (auto value = QaplaHelpers::to_uint32(item)) {
+                result.push_back(*value);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Reads the games appended to the PGN file of the worker.
+     */
+    class PgnTail {
+    public:
+        explicit PgnTail(std::string fileName) : fileName_(std::move(fileName)) {}
+
+        /**
+         * @brief Gets the games completed since the last call.
+         * @param all True to get all remaining text, e.g. when the games are finished.
+         */
+        std::vector<std::string> read(bool all) {
+            std::ifstream in(fileName_, std::ios::binary);
+            if (in) {
+                in.seekg(static_cast<std::streamoff>(offset_));
+                std::string appended{ std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+                offset_ += appended.size();
+                splitter_.feed(appended);
+            }
+            return splitter_.take(all);
+        }
+
+    private:
+        std::string fileName_;
+        uint64_t offset_ = 0;
+        PgnGameSplitter splitter_;
+    };
+
+    class TournamentWorker {
+    public:
+        explicit TournamentWorker(WorkerSocket& socket) : socket_(socket) {}
+
+        int run(const std::string& job);
+
+    private:
+        void loadJob(const IniFile::SectionList& sections);
+        bool runSlice(const TournamentSlice& slice);
+        void handleMessages();
+        void sendGames(bool all);
+        void sendProgress();
+        void sendResults(const Tournament& tournament);
+
+        WorkerSocket& socket_;
+        GameManagerPoolAccess pool_;
+        TournamentConfig config_;
+        std::vector<EngineConfig> engines_;
+        std::vector<TournamentSlice> slices_;
+        IniFile::SectionList rounds_;          ///< Results of games played before the start
+        IniFile::SectionList playedRounds_;    ///< Results of the finished slices
+        QaplaTester::ChangeTracker changeTracker_;
+        uint32_t concurrency_ = 1;
+        std::unique_ptr<PgnTail> tail_;
+        uint32_t finishedGames_ = 0;
+        bool stopping_ = false;
+    };
+
+    void TournamentWorker::loadJob(const IniFile::SectionList& sections) {
+        using namespace QaplaConfiguration;
+        config_ = QaplaTester::TournamentConfigFile::fromManager(
+            loadGroupIntoManager("tournament", sectionsNamed(sections, "tournament")), "tournament");
+        config_.openings = QaplaTester::OpeningConfig::fromManager(
+            loadGroupIntoManager("openings", sectionsNamed(sections, "openings")), "openings");
+        // Results are streamed to the coordinator, the worker keeps no tournament file
+        config_.tournamentFilename.clear();
+
+        auto pgnOptions = QaplaTester::PgnConfig::fromManager(
+            loadGroupIntoManager("pgnoutput", sectionsNamed(sections, "pgnoutput")), "pgnoutput");
+        
+        auto drawConfig = QaplaTester::AdjudicationConfig::fromDrawManager(
+            loadGroupIntoManager("draw", sectionsNamed(sections, "draw")), "draw");
+        auto resignConfig = QaplaTester::AdjudicationConfig::fromResignManager(
+            loadGroupIntoManager("resign", sectionsNamed(sections, "resign")), "resign");
+        pool_->getAdjudicationManager().setDrawAdjudicationConfig(drawConfig);
+        pool_->getAdjudicationManager().setResignAdjudicationConfig(resignConfig);
+
+        for (const auto& section : sectionsNamed(sections, "engine")) {
+            engines_.push_back(EngineConfig::createFromSection(section));
+        }
+        rounds_ = sectionsNamed(sections, "round");
+        for (const auto& section : sectionsNamed(sections, "slice")) {
+            auto gauntlet = QaplaHelpers::to_uint32(section.getValue("gauntlet").value_or(""));
+            auto opponents = parseIndices(section.getValue("opponents").value_or(""));
+            if (!gauntlet || *gauntlet >= engines_.size()) {
+                throw std::runtime_error("Invalid slice in worker job");
+            }
+            std::erase_if(opponents, [&](size_t index) { return index >= engines_.size(); });
+            slices_.push_back(TournamentSlice{ .gauntlet = *gauntlet, .opponents = std::move(opponents) });
+        }
+
+        auto workerSections = sectionsNamed(sections, "worker");
+        if (workerSections.empty()) {
+            throw std::runtime_error("Missing worker section in job");
+        }
+        const auto& worker = workerSections.front();
+        concurrency_ = std::max(1U, QaplaHelpers::to_uint32(worker.getValue("concurrency").value_or("1")).value_or(1));
+        pgnOptions.file = worker.getValue("pgnfile").value_or("");
+        if (pgnOptions.file.empty()) {
+            throw std::runtime_error("Missing PGN file in worker job");
+        }
+        std::filesystem::remove(pgnOptions.file);
+        QaplaTester::PgnSave::tournament().setOptions(pgnOptions);
+        tail_ = std::make_unique<PgnTail>(pgnOptions.file);
+    }
+
+    void TournamentWorker::handleMessages() {
+        while (auto message = socket_.receive(0)) {
+            if (message->type != WorkerMessageType::Stop || stopping_) {
+                continue;
+            }
+            stopping_ = true;
+            if (message->payload == "graceful") {
+                pool_->setConcurrency(0, true, true);
+            } else {
+                pool_->stopAll();
+            }
+        }
+        if (!socket_.isOpen() && !stopping_) {
+            // Without coordinator nobody receives the games
+            stopping_ = true;
+            pool_->stopAll();
+        }
+    }
+
+    void TournamentWorker::sendGames(bool all) {
+        for (auto& game : tail_->read(all)) {
+            finishedGames_++;
+            socket_.send(WorkerMessage{ .type = WorkerMessageType::Games, .payload = std::move(game) });
+        }
+    }
+
+    void TournamentWorker::sendResults(const Tournament& tournament) {
+        auto [isModified, isUpdated] = changeTracker_.checkModification(tournament.getChangeTracker());
+        if (!isUpdated) {
+            return;
+        }
+        changeTracker_.updateFrom(tournament.getChangeTracker());
+        auto sections = playedRounds_;
+        auto current = tournament.getSections();
+        sections.insert(sections.end(), current.begin(), current.end());
+        std::ostringstream out;
+        IniFile::saveSections(out, sections);
+        socket_.send(WorkerMessage{ .type = WorkerMessageType::Results, .payload = out.str() });
+    }
+
+    void TournamentWorker::sendProgress() {
+        socket_.send(WorkerMessage{ .type = WorkerMessageType::Progress, 
+            .payload = std::format("{} {}", finishedGames_, pool_->runningGameCount()) });
+    }
+
+    bool TournamentWorker::runSlice(const TournamentSlice& slice) {
+        std::vector<EngineConfig> engines;
+        auto gauntlet = engines_[slice.gauntlet];
+        gauntlet.gauntlet() = true;
+        engines.push_back(std::move(gauntlet));
+        for (auto index : slice.opponents) {
+            auto opponent = engines_[index];
+            opponent.gauntlet() = false;
+            engines.push_back(std::move(opponent));
+        }
+        auto config = config_;
+        config.type = "gauntlet";
+        if (Tournament::calculateTotalGames(engines, config) == 0) {
+            return true;
+        }
+
+        Tournament tournament;
+        tournament.createTournament(engines, config);
+        // Continues the slice from the results saved with the tournament
+        auto rounds = roundsOfSlice(rounds_, engines);
+        if (!rounds.empty()) {
+            tournament.load(TournamentSlicer::orientRounds(std::move(rounds), TournamentSlicer::pairings(tournament)));
+        }
+        pool_->clearAll();
+        tournament.scheduleAll(0, false, *pool_);
+        pool_->setConcurrency(concurrency_, true, true);
+        changeTracker_ = QaplaTester::ChangeTracker{};
+
+        const auto start = std::chrono::steady_clock::now();
+        auto lastProgress = start;
+        bool started = false;
+        while (true) {
+            std::this_thread::sleep_for(POLL_INTERVAL);
+            handleMessages();
+            auto running = pool_->runningGameCount();
+            started = started || running > 0;
+            sendGames(false);
+            sendResults(tournament);
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastProgress >= PROGRESS_INTERVAL) {
+                lastProgress = now;
+                sendProgress();
+            }
+            if (running > 0) {
+                continue;
+            }
+            if (stopping_ || ((started || now - start > START_GRACE_TIME) && pool_->areAllTasksFinished())) {
+                auto played = tournament.getSections();
+                playedRounds_.insert(playedRounds_.end(), played.begin(), played.end());
+                return !stopping_;
+            }
+        }
+    }
+
+    int TournamentWorker::run(const std::string& job) {
+        try {
+            std::istringstream in(job);
+            loadJob(IniFile::load(in));
+            for (const auto& slice : slices_) {
+                if (!runSlice(slice)) {
+                    break;
+                }
+            }
+        }
+        catch (const std::exception& e) {
+            socket_.send(WorkerMessage{ .type = WorkerMessageType::Error, .payload = e.what() });
+        }
+        pool_->stopAll();
+        pool_->waitForTask();
+        if (tail_) {
+            sendGames(true);
+        }
+        sendProgress();
+        socket_.send(WorkerMessage{ .type = WorkerMessageType::Done, .payload = std::to_string(finishedGames_) });
+        return 0;
+    }
+}
+
+int runTournamentWorker(const std::string& address) {
+    try {
+        // Logging follows the settings of the GUI, the worker never saves the configuration
+        QaplaConfiguration::Configuration::instance().loadFile();
+        QaplaConfiguration::Configuration::loadLoggerConfiguration();
+
+        auto socket = WorkerSocket::connect(address);
+        const char* slot = std::getenv("QAPLA_WORKER_SLOT");
+        socket.send(WorkerMessage{ .type = WorkerMessageType::Hello, .payload = slot != nullptr ? slot : "" });
+        auto job = socket.receive(JOB_TIMEOUT_MS);
+        if (!job || job->type != WorkerMessageType::Job) {
+            std::cerr << "Worker: no job received from " << address << '\n';
+            return 1;
+        }
+        TournamentWorker worker(socket);
+        return worker.run(job->payload);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Worker: " << e.what() << '\n';
+        return 1;
+    }
+}
+
+} // namespace QaplaWindows
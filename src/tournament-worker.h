@@ -0,0 +1,39 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <string>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Runs the executable as headless tournament worker.
+ * 
+ * The worker connects to the coordinator, receives a job with the tournament configuration,
+ * the engines and its slices of the pairings, plays the slices in its own game manager pool 
+ * and streams the PGN of every finished game back. It is started by the coordinator with the 
+ * environment variable QAPLA_WORKER set to the coordinator address.
+ * 
+ * @param address Address of the coordinator, see WorkerSocket.
+ * @return Process exit code.
+ */
+int runTournamentWorker(const std::string& address);
+
+} // namespace QaplaWindows
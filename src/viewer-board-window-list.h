@@ -22,6 +22,7 @@
 #include "viewer-board-window.h"
 #include "game-manager-pool-access.h"
 #include "imgui-table.h"
+#include "callback-manager.h"
 
 #include <vector>
 #include <functional>
@@ -116,6 +117,13 @@ public:
      * @return True if at least one window is running, false otherwise.
      */
     [[nodiscard]] 
+    /**
+     * @brief Checks if one of the board windows was drawn in the current or the previous frame.
+     */
+    [[nodiscard]] bool isVisible() const {
+        return visibility_.isVisible();
+    }
+
     bool isAnyRunning() const {
         return std::ranges::any_of(boardWindows_,
             [](const ViewerBoardWindow& window) { return window.isRunning(); });
@@ -172,6 +180,7 @@ private:
     size_t selectedIndex_ = 0;
     std::string name_;
     std::string activeWindowId_;
+    Visibility visibility_;
 
     /**
      * @brief Ensures that a window exists at the given index.
@@ -225,6 +234,7 @@ private:
                     boardWindows_[selectedIndex_].draw();
                 }
                 window.setActive(true);
+                visibility_.markDrawn();
                 newIndex = index;
                 ImGui::EndTabItem();
             } else {
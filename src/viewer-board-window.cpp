@@ -42,6 +42,8 @@ namespace QaplaWindows
 
     ViewerBoardWindow::ViewerBoardWindow() {
         imGuiEngineList_.setAllowInput(false);
+        // The object itself, its tables are accounted by their own subsystems
+        memory_.set(sizeof(ViewerBoardWindow));
     }
 
     ViewerBoardWindow::ViewerBoardWindow(ViewerBoardWindow&&) noexcept = default;
@@ -29,6 +29,7 @@
 #include "imgui-clock.h"
 #include "imgui-move-list.h"
 #include "imgui-barchart.h"
+#include "memory-accounting.h"
 
 namespace QaplaTester
 {
@@ -130,6 +131,7 @@ namespace QaplaWindows
         ImGuiClock imGuiClock_;
         ImGuiMoveList imGuiMoveList_;
         ImGuiBarChart imGuiBarChart_;
+        MemoryAccounting::Account memory_{"Viewer boards"};
     };
 
 }
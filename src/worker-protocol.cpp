@@ -0,0 +1,467 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#include "worker-protocol.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace QaplaWindows {
+
+namespace {
+    constexpr size_t HEADER_SIZE = 5;
+    constexpr size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+    constexpr int LISTEN_BACKLOG = 64;
+
+    struct ParsedAddress {
+        bool isUnix = true;
+        std::string path;
+        std::string host;
+        std::string port;
+    };
+
+    ParsedAddress parseAddress(const std::string& address) {
+        if (address.starts_with("unix:")) {
+            return ParsedAddress{ .isUnix = true, .path = address.substr(5), .host = {}, .port = {} };
+        }
+        if (address.starts_with("tcp:")) {
+            auto hostPort = address.substr(4);
+            auto colon = hostPort.rfind(':');
+            if (colon == std::string::npos || colon + 1 == hostPort.size()) {
+                throw std::runtime_error(std::format("Missing port in worker address: {}", address));
+            }
+            return ParsedAddress{ .isUnix = false, .path = {}, 
+                .host = hostPort.substr(0, colon), .port = hostPort.substr(colon + 1) };
+        }
+        throw std::runtime_error(std::format("Invalid worker address: {}", address));
+    }
+
+#ifndef _WIN32
+    sockaddr_un unixAddress(const std::string& path) {
+        sockaddr_un result{};
+        result.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(result.sun_path)) {
+            throw std::runtime_error(std::format("Invalid socket path: {}", path));
+        }
+        std::memcpy(result.sun_path, path.c_str(), path.size() + 1);
+        return result;
+    }
+
+    addrinfo* resolve(const ParsedAddress& parsed, bool passive) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = passive ? AI_PASSIVE : 0;
+        addrinfo* result = nullptr;
+        const char* host = parsed.host.empty() || parsed.host == "*" ? nullptr : parsed.host.c_str();
+        if (::getaddrinfo(host, parsed.port.c_str(), &hints, &result) != 0 || result == nullptr) {
+            throw std::runtime_error(std::format("Failed to resolve {}:{}", parsed.host, parsed.port));
+        }
+        return result;
+    }
+
+#ifdef MSG_NOSIGNAL
+    constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    constexpr int SEND_FLAGS = 0;
+#endif
+
+    /**
+     * Creates a socket that is not inherited by engine processes started later.
+     */
+    int createSocket(int family, int type, int protocol) {
+        int fd = ::socket(family, type, protocol);
+        if (fd >= 0) {
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        return fd;
+    }
+
+    void setNoDelay(int fd) {
+        int one = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// WorkerFrameCodec
+// ------------------------------------------------------------------------------------------------
+
+std::string WorkerFrameCodec::encode(const WorkerMessage& message) {
+    if (message.payload.size() > MAX_PAYLOAD_SIZE) {
+        throw std::runtime_error("Worker message too large");
+    }
+    auto length = static_cast<uint32_t>(message.payload.size());
+    std::string frame;
+    frame.reserve(HEADER_SIZE + message.payload.size());
+    for (int shift = 0; shift < 32; shift += 8) {
+        frame.push_back(static_cast<char>((length >> shift) & 0xFF));
+    }
+    frame.push_back(static_cast<char>(message.type));
+    frame.append(message.payload);
+    return frame;
+}
+
+void WorkerFrameCodec::feed(std::string_view data) {
+    // Drops consumed frames before the buffer grows
+    if (offset_ > 0 && offset_ == buffer_.size()) {
+        buffer_.clear();
+        offset_ = 0;
+    } else if (offset_ > RECEIVE_BUFFER_SIZE) {
+        buffer_.erase(0, offset_);
+        offset_ = 0;
+    }
+    buffer_.append(data);
+}
+
+std::optional<WorkerMessage> WorkerFrameCodec::next() {
+    if (buffer_.size() - offset_ < HEADER_SIZE) {
+        return std::nullopt;
+    }
+    const auto* header = reinterpret_cast<const unsigned char*>(buffer_.data() + offset_);
+    uint32_t length = 0;
+    for (int index = 0; index < 4; ++index) {
+        length |= static_cast<uint32_t>(header[index]) << (index * 8);
+    }
+    auto type = header[4];
+    if (length > MAX_PAYLOAD_SIZE || type < static_cast<uint8_t>(WorkerMessageType::Hello) 
+        || type > static_cast<uint8_t>(WorkerMessageType::Results)) {
+        throw std::runtime_error("Malformed worker message");
+    }
+    if (buffer_.size() - offset_ - HEADER_SIZE < length) {
+        return std::nullopt;
+    }
+    WorkerMessage message{ 
+        .type = static_cast<WorkerMessageType>(type), 
+        .payload = buffer_.substr(offset_ + HEADER_SIZE, length) 
+    };
+    offset_ += HEADER_SIZE + length;
+    return message;
+}
+
+// ------------------------------------------------------------------------------------------------
+// PgnGameSplitter
+// ------------------------------------------------------------------------------------------------
+
+void PgnGameSplitter::feed(std::string_view text) {
+    pending_.append(text);
+    scan();
+}
+
+void PgnGameSplitter::scan() {
+    for (; scanned_ < pending_.size(); ++scanned_) {
+        const char c = pending_[scanned_];
+        const bool lineStart = std::exchange(lineStart_, c == '\n');
+        if (inComment_) {
+            inComment_ = c != '}';
+        } else if (inLineComment_) {
+            inLineComment_ = c != '\n';
+        } else if (inString_) {
+            inString_ = escaped_ || c != '"';
+            escaped_ = !escaped_ && c == '\\';
+        } else if (inTag_) {
+            inString_ = c == '"';
+            inTag_ = c != ']';
+        } else if (c == '[' && lineStart) {
+            if (movetext_) {
+                starts_.push_back(scanned_);
+                movetext_ = false;
+            }
+            inTag_ = true;
+        } else if (c == '{') {
+            inComment_ = true;
+            movetext_ = true;
+        } else if (c == ';') {
+            inLineComment_ = true;
+            movetext_ = true;
+        } else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            movetext_ = true;
+        }
+    }
+}
+
+void PgnGameSplitter::resetScan() {
+    scanned_ = 0;
+    starts_.clear();
+    lineStart_ = true;
+    inComment_ = false;
+    inLineComment_ = false;
+    inTag_ = false;
+    inString_ = false;
+    escaped_ = false;
+    movetext_ = false;
+}
+
+std::vector<std::string> PgnGameSplitter::take(bool all) {
+    std::vector<std::string> games;
+    size_t begin = 0;
+    for (auto start : starts_) {
+        games.push_back(pending_.substr(begin, start - begin));
+        begin = start;
+    }
+    const bool quiet = !inComment_ && !inLineComment_ && !inTag_;
+    const bool lastComplete = movetext_ && quiet 
+        && (pending_.ends_with("\n\n") || pending_.ends_with("\n\r\n"));
+    if (begin < pending_.size() && (all || lastComplete)) {
+        games.push_back(pending_.substr(begin));
+        pending_.clear();
+        resetScan();
+        return games;
+    }
+    // Keeps the incomplete last game, its scan state stays valid after the shift
+    pending_.erase(0, begin);
+    scanned_ -= begin;
+    starts_.clear();
+    return games;
+}
+
+// ------------------------------------------------------------------------------------------------
+// WorkerSocket
+// ------------------------------------------------------------------------------------------------
+
+WorkerSocket::~WorkerSocket() {
+    close();
+}
+
+WorkerSocket::WorkerSocket(WorkerSocket&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)), codec_(std::move(other.codec_)) {
+}
+
+WorkerSocket& WorkerSocket::operator=(WorkerSocket&& other) noexcept {
+    if (this != &other) {
+        close();
+        fd_ = std::exchange(other.fd_, -1);
+        codec_ = std::move(other.codec_);
+    }
+    return *this;
+}
+
+bool WorkerSocket::isSupported() {
+#ifdef _WIN32
+    return false;
+#else
+    return true;
+#endif
+}
+
+WorkerSocket WorkerSocket::connect(const std::string& address) {
+#ifdef _WIN32
+    throw std::runtime_error("Worker processes are not supported on this platform");
+#else
+    auto parsed = parseAddress(address);
+    if (parsed.isUnix) {
+        auto socketAddress = unixAddress(parsed.path);
+        int fd = createSocket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) != 0) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw std::runtime_error(std::format("Failed to connect to {}", address));
+        }
+        return WorkerSocket(fd);
+    }
+    auto* addresses = resolve(parsed, false);
+    for (auto* candidate = addresses; candidate != nullptr; candidate = candidate->ai_next) {
+        int fd = createSocket(candidate->ai_family, candidate->ai_socktype, candidate->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (::connect(fd, candidate->ai_addr, candidate->ai_addrlen) == 0) {
+            ::freeaddrinfo(addresses);
+            setNoDelay(fd);
+            return WorkerSocket(fd);
+        }
+        ::close(fd);
+    }
+    ::freeaddrinfo(addresses);
+    throw std::runtime_error(std::format("Failed to connect to {}", address));
+#endif
+}
+
+bool WorkerSocket::send([[maybe_unused]] const WorkerMessage& message) {
+#ifdef _WIN32
+    return false;
+#else
+    if (fd_ < 0) {
+        return false;
+    }
+    auto frame = WorkerFrameCodec::encode(message);
+    size_t written = 0;
+    while (written < frame.size()) {
+        auto result = ::send(fd_, frame.data() + written, frame.size() - written, SEND_FLAGS);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            close();
+            return false;
+        }
+        written += static_cast<size_t>(result);
+    }
+    return true;
+#endif
+}
+
+std::optional<WorkerMessage> WorkerSocket::receive([[maybe_unused]] int timeoutMs) {
+#ifdef _WIN32
+    return std::nullopt;
+#else
+    if (auto message = codec_.next()) {
+        return message;
+    }
+    while (fd_ >= 0) {
+        pollfd pollFd{ .fd = fd_, .events = POLLIN, .revents = 0 };
+        int ready = ::poll(&pollFd, 1, timeoutMs);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return std::nullopt;
+        }
+        std::array<char, RECEIVE_BUFFER_SIZE> buffer{};
+        auto bytes = ::recv(fd_, buffer.data(), buffer.size(), 0);
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes <= 0) {
+            close();
+            return std::nullopt;
+        }
+        codec_.feed(std::string_view(buffer.data(), static_cast<size_t>(bytes)));
+        if (auto message = codec_.next()) {
+            return message;
+        }
+        // Waits for the rest of the frame without waiting again for the full timeout
+        timeoutMs = std::min(timeoutMs, 100);
+    }
+    return std::nullopt;
+#endif
+}
+
+void WorkerSocket::close() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+#endif
+    fd_ = -1;
+}
+
+// ------------------------------------------------------------------------------------------------
+// WorkerListener
+// ------------------------------------------------------------------------------------------------
+
+WorkerListener::~WorkerListener() {
+    close();
+}
+
+void WorkerListener::listen([[maybe_unused]] const std::string& address) {
+#ifdef _WIN32
+    throw std::runtime_error("Worker processes are not supported on this platform");
+#else
+    close();
+    auto parsed = parseAddress(address);
+    if (parsed.isUnix) {
+        auto socketAddress = unixAddress(parsed.path);
+        ::unlink(parsed.path.c_str());
+        fd_ = createSocket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd_ < 0 || ::bind(fd_, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) != 0
+            || ::listen(fd_, LISTEN_BACKLOG) != 0 || ::fcntl(fd_, F_SETFL, O_NONBLOCK) != 0) {
+            close();
+            throw std::runtime_error(std::format("Failed to listen on {}", address));
+        }
+        unixPath_ = parsed.path;
+        address_ = address;
+        return;
+    }
+    auto* addresses = resolve(parsed, true);
+    for (auto* candidate = addresses; candidate != nullptr && fd_ < 0; candidate = candidate->ai_next) {
+        fd_ = createSocket(candidate->ai_family, candidate->ai_socktype, candidate->ai_protocol);
+        if (fd_ < 0) {
+            continue;
+        }
+        int one = 1;
+        ::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (::bind(fd_, candidate->ai_addr, candidate->ai_addrlen) != 0 || ::listen(fd_, LISTEN_BACKLOG) != 0
+            || ::fcntl(fd_, F_SETFL, O_NONBLOCK) != 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+    ::freeaddrinfo(addresses);
+    if (fd_ < 0) {
+        throw std::runtime_error(std::format("Failed to listen on {}", address));
+    }
+    address_ = address;
+#endif
+}
+
+std::optional<WorkerSocket> WorkerListener::accept() {
+#ifdef _WIN32
+    return std::nullopt;
+#else
+    if (fd_ < 0) {
+        return std::nullopt;
+    }
+    int fd = ::accept(fd_, nullptr, nullptr);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    // The accepted socket may inherit the non-blocking mode of the listener
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    if (unixPath_.empty()) {
+        setNoDelay(fd);
+    }
+    return WorkerSocket(fd);
+#endif
+}
+
+void WorkerListener::close() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    if (!unixPath_.empty()) {
+        ::unlink(unixPath_.c_str());
+    }
+#endif
+    fd_ = -1;
+    unixPath_.clear();
+    address_.clear();
+}
+
+} // namespace QaplaWindows
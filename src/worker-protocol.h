@@ -0,0 +1,202 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Volker Böhm
+ * @copyright Copyright (c) 2025 Volker Böhm
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QaplaWindows {
+
+/**
+ * @brief Messages exchanged between the tournament coordinator and its worker processes.
+ */
+enum class WorkerMessageType : uint8_t {
+    Hello = 1,     ///< Worker to coordinator, payload: slot number assigned at spawn
+    Job = 2,       ///< Coordinator to worker, payload: INI sections describing the job
+    Games = 3,     ///< Worker to coordinator, payload: PGN text of one finished game
+    Progress = 4,  ///< Worker to coordinator, payload: "<finished games> <running games>"
+    Done = 5,      ///< Worker to coordinator, the job is finished or stopped
+    Stop = 6,      ///< Coordinator to worker, payload: "graceful" or "abort"
+    Error = 7,     ///< Either direction, payload: error message
+    Results = 8    ///< Worker to coordinator, payload: INI round sections of all games of the worker
+};
+
+struct WorkerMessage {
+    WorkerMessageType type = WorkerMessageType::Error;
+    std::string payload;
+};
+
+/**
+ * @brief Length prefixed framing of worker messages on a byte stream.
+ * 
+ * A frame is a 32 bit little endian payload length, one byte message type and the payload.
+ */
+class WorkerFrameCodec {
+public:
+    static constexpr uint32_t MAX_PAYLOAD_SIZE = 256U * 1024U * 1024U;
+
+    /**
+     * @brief Encodes a message to a frame.
+     */
+    [[nodiscard]] static std::string encode(const WorkerMessage& message);
+
+    /**
+     * @brief Appends received bytes.
+     */
+    void feed(std::string_view data);
+
+    /**
+     * @brief Gets the next complete message.
+     * @return The message, or std::nullopt if more bytes are needed.
+     * @throws std::runtime_error on a malformed frame.
+     */
+    std::optional<WorkerMessage> next();
+
+private:
+    std::string buffer_;
+    size_t offset_ = 0;
+};
+
+/**
+ * @brief Cuts PGN text appended to a file into complete games.
+ * 
+ * A game ends where the tag section of the next game starts. Brackets inside comments and 
+ * tag values are not taken as the start of a game.
+ */
+class PgnGameSplitter {
+public:
+    /**
+     * @brief Appends text read from the PGN file.
+     */
+    void feed(std::string_view text);
+
+    /**
+     * @brief Takes the complete games, each with its trailing empty lines.
+     * @param all True to take the last game as well, e.g. when no further text is written.
+     * The last game is also taken if its movetext is followed by an empty line.
+     */
+    std::vector<std::string> take(bool all);
+
+private:
+    void scan();
+    void resetScan();
+
+    std::string pending_;
+    size_t scanned_ = 0;
+    std::vector<size_t> starts_;  ///< Offsets of game starts after the first game in pending_
+    bool lineStart_ = true;
+    bool inComment_ = false;      ///< Inside a {} comment
+    bool inLineComment_ = false;  ///< Inside a ; comment
+    bool inTag_ = false;
+    bool inString_ = false;       ///< Inside a quoted tag value
+    bool escaped_ = false;
+    bool movetext_ = false;       ///< Movetext seen since the last tag section
+};
+
+/**
+ * @brief Stream socket connection carrying worker messages.
+ * 
+ * Addresses are "unix:<path>" for Unix domain sockets or "tcp:<host>:<port>". Worker 
+ * processes are only supported on POSIX systems.
+ */
+class WorkerSocket {
+public:
+    WorkerSocket() = default;
+    explicit WorkerSocket(int fd) : fd_(fd) {}
+    ~WorkerSocket();
+
+    WorkerSocket(const WorkerSocket&) = delete;
+    WorkerSocket& operator=(const WorkerSocket&) = delete;
+    WorkerSocket(WorkerSocket&& other) noexcept;
+    WorkerSocket& operator=(WorkerSocket&& other) noexcept;
+
+    /**
+     * @brief Checks if the platform supports worker sockets.
+     */
+    [[nodiscard]] static bool isSupported();
+
+    /**
+     * @brief Connects to a listening coordinator.
+     * @param address Address of the coordinator.
+     * @throws std::runtime_error if the connection fails.
+     */
+    [[nodiscard]] static WorkerSocket connect(const std::string& address);
+
+    /**
+     * @brief Sends a message, blocking until it is written completely.
+     * @return False if the connection is closed.
+     */
+    bool send(const WorkerMessage& message);
+
+    /**
+     * @brief Receives the next message.
+     * @param timeoutMs Maximal time to wait, 0 only checks for available data.
+     * @return The message, or std::nullopt on timeout or when the connection is closed.
+     * @throws std::runtime_error on a malformed frame.
+     */
+    std::optional<WorkerMessage> receive(int timeoutMs);
+
+    [[nodiscard]] bool isOpen() const { return fd_ >= 0; }
+
+    void close();
+
+private:
+    int fd_ = -1;
+    WorkerFrameCodec codec_;
+};
+
+/**
+ * @brief Listening socket of the coordinator.
+ */
+class WorkerListener {
+public:
+    WorkerListener() = default;
+    ~WorkerListener();
+
+    WorkerListener(const WorkerListener&) = delete;
+    WorkerListener& operator=(const WorkerListener&) = delete;
+
+    /**
+     * @brief Starts listening. An existing Unix socket file at the path is replaced.
+     * @param address Address to listen on.
+     * @throws std::runtime_error if the address cannot be bound.
+     */
+    void listen(const std::string& address);
+
+    /**
+     * @brief Accepts a pending connection without blocking.
+     * @return The connection, or std::nullopt if no worker is waiting.
+     */
+    std::optional<WorkerSocket> accept();
+
+    [[nodiscard]] const std::string& address() const { return address_; }
+
+    void close();
+
+private:
+    int fd_ = -1;
+    std::string address_;
+    std::string unixPath_;  ///< Socket file removed on close
+};
+
+} // namespace QaplaWindows